@@ -0,0 +1,46 @@
+#include "audio_backend.h"
+
+#include <stddef.h>
+
+bool audioBackendStart(AudioBackend *backend) {
+    if (backend->running) {
+        return true;
+    }
+    backend->running = backend->ops->start(backend);
+    return backend->running;
+}
+
+void audioBackendStop(AudioBackend *backend) {
+    if (backend->running) {
+        backend->ops->stop(backend);
+        backend->running = false;
+    }
+}
+
+unsigned audioBackendPump(AudioBackend *backend, unsigned frames) {
+    if (!backend->running || backend->ops->pump == NULL) {
+        return 0;
+    }
+    return backend->ops->pump(backend, frames);
+}
+
+void audioBackendDestroy(AudioBackend *backend) {
+    if (backend == NULL) {
+        return;
+    }
+    audioBackendStop(backend);
+    backend->ops->destroy(backend);
+}
+
+void audioBackendRenderBurst(AudioBackend *backend, void *dst, unsigned frames) {
+    backend->render(backend->context, dst, frames, backend->channels, backend->format);
+    backend->framesRendered += frames;
+}
+
+unsigned audioSampleBytes(AudioSampleFormat format) {
+    return format == AUDIO_FORMAT_FLOAT ? sizeof(float) : sizeof(short);
+}
+
+unsigned audioBackendFrameBytes(const AudioBackend *backend) {
+    return backend->channels * audioSampleBytes(backend->format);
+}
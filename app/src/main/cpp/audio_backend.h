@@ -0,0 +1,85 @@
+#ifndef NATIVEAUDIO_AUDIO_BACKEND_H
+#define NATIVEAUDIO_AUDIO_BACKEND_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "callback_stats.h"
+
+//音频输出后端：后端按突发调用 render 取得单声道或交错立体声的样本（int16 或 float，
+//由后端的 channels 和 format 决定），再交给设备或文件。
+//实时后端（OpenSL ES）由设备的回调线程驱动；null/WAV 后端没有自己的线程，
+//由调用方用 audioBackendPump 推进一个确定性的时钟，同样的输入总是得到同样的输出
+
+//后端送给设备的样本格式。引擎内部总是用 float 混音，只在最后一步按这个格式输出
+typedef enum {
+    AUDIO_FORMAT_S16 = 0,
+    //[-1, 1) 满幅的 32 位 float，OpenSL ES 需要 PCM_EX（API 21 起）
+    AUDIO_FORMAT_FLOAT,
+} AudioSampleFormat;
+
+//dst 按 format 解释，frames 帧，每帧 channels（1 或 2）个交错的样本
+typedef void (*AudioRenderCallback)(void *context, void *dst, unsigned frames, unsigned channels,
+                                    AudioSampleFormat format);
+
+typedef struct AudioBackend AudioBackend;
+
+typedef struct AudioBackendOps {
+    const char *name;
+
+    bool (*start)(AudioBackend *backend);
+
+    void (*stop)(AudioBackend *backend);
+
+    //渲染 frames 帧，返回实际渲染的帧数；实时后端为 NULL
+    unsigned (*pump)(AudioBackend *backend, unsigned frames);
+
+    void (*destroy)(AudioBackend *backend);
+} AudioBackendOps;
+
+struct AudioBackend {
+    const AudioBackendOps *ops;
+    unsigned sampleRate;
+    unsigned burstFrames;
+    unsigned channels;
+    AudioSampleFormat format;
+    //一个突发渲染完后要排在多少个突发（含它自己）后面才开始播放，用于估计输出延迟
+    unsigned bufferedBursts;
+    AudioRenderCallback render;
+    void *context;
+    bool running;
+    //已经渲染的帧数，也就是确定性后端的时钟
+    uint64_t framesRendered;
+    //不为 NULL 时实时后端在每次回调里记录计时统计
+    CallbackStats *stats;
+};
+
+//null 后端：渲染后丢弃，用来测量填充逻辑本身的开销
+AudioBackend *audioBackendCreateNull(unsigned sampleRate, unsigned burstFrames,
+                                     unsigned channels, AudioSampleFormat format,
+                                     AudioRenderCallback render, void *context);
+
+//WAV 后端：把渲染结果写成 16 位整数或 32 位 float 的 WAV 文件，停止或销毁时补全文件头
+AudioBackend *audioBackendCreateWav(const char *path, unsigned sampleRate, unsigned burstFrames,
+                                    unsigned channels, AudioSampleFormat format,
+                                    AudioRenderCallback render, void *context);
+
+bool audioBackendStart(AudioBackend *backend);
+
+void audioBackendStop(AudioBackend *backend);
+
+//只对确定性后端有效，没有启动或是实时后端时返回 0
+unsigned audioBackendPump(AudioBackend *backend, unsigned frames);
+
+void audioBackendDestroy(AudioBackend *backend);
+
+//后端实现使用：渲染一个突发并推进时钟
+void audioBackendRenderBurst(AudioBackend *backend, void *dst, unsigned frames);
+
+//一个样本的字节数
+unsigned audioSampleBytes(AudioSampleFormat format);
+
+//后端一帧的字节数
+unsigned audioBackendFrameBytes(const AudioBackend *backend);
+
+#endif //NATIVEAUDIO_AUDIO_BACKEND_H
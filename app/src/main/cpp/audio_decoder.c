@@ -0,0 +1,64 @@
+#include "audio_decoder.h"
+
+#include <stddef.h>
+
+AudioDecoder *audioDecoderOpen(const AudioDecoderSource *source,
+                               const AudioDecoderOpenFn *openers, unsigned count) {
+    unsigned i;
+    for (i = 0; i < count; ++i) {
+        AudioDecoder *decoder = openers[i](source);
+        if (decoder != NULL) {
+            return decoder;
+        }
+    }
+    return NULL;
+}
+
+bool audioDecoderKeepStereo(AudioDecoder *decoder) {
+    decoder->stereo = decoder->channels == 2;
+    return decoder->stereo;
+}
+
+unsigned audioDecoderRead(AudioDecoder *decoder, short *dst, unsigned frames) {
+    return frames > 0 ? decoder->ops->read(decoder, dst, frames) : 0;
+}
+
+void audioDecoderClose(AudioDecoder *decoder) {
+    if (decoder != NULL) {
+        decoder->ops->close(decoder);
+    }
+}
+
+void audioDecoderDownmixS16(const short *src, unsigned channels, short *dst, unsigned frames) {
+    unsigned i, c;
+    if (channels == 1) {
+        if (dst != src) {
+            for (i = 0; i < frames; ++i) {
+                dst[i] = src[i];
+            }
+        }
+        return;
+    }
+    if (channels == 2) {
+        //最常见的立体声单独处理，编译器可以向量化
+        for (i = 0; i < frames; ++i) {
+            dst[i] = (short) ((src[2 * i] + src[2 * i + 1]) >> 1);
+        }
+        return;
+    }
+    for (i = 0; i < frames; ++i) {
+        int sum = 0;
+        for (c = 0; c < channels; ++c) {
+            sum += src[i * channels + c];
+        }
+        dst[i] = (short) (sum / (int) channels);
+    }
+}
+
+void audioDecoderStereoS16(const short *src, unsigned channels, short *dst, unsigned frames) {
+    unsigned i;
+    for (i = 0; i < frames; ++i) {
+        dst[2 * i] = src[i * channels];
+        dst[2 * i + 1] = src[i * channels + (channels > 1)];
+    }
+}
@@ -0,0 +1,72 @@
+#ifndef NATIVEAUDIO_AUDIO_DECODER_H
+#define NATIVEAUDIO_AUDIO_DECODER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+//解码器：把一个音频文件（或文件中的一段，例如 APK 里的资源）逐块解码成引擎声部的格式，
+//也就是源采样率下的 16 位单声道 PCM，多声道的源按平均值混成单声道。
+//立体声的源可以用 audioDecoderKeepStereo 改成输出交错的立体声，保留左右声道。
+//每种格式一个打开函数，认不出数据时返回 NULL，所以调用方可以按顺序依次尝试几个解码器；
+//WAV/PCM 解码器与平台无关，压缩格式由平台的解码器（Android 上是 MediaCodec）实现同一个接口。
+//一个解码器实例只在一个线程中使用，可以在打开它的线程之外读取
+
+//解码的数据源：fd 中从 start 开始的 length 字节。打开函数需要的话会自己 dup，调用方可以随后关闭 fd
+typedef struct {
+    int fd;
+    off_t start;
+    off_t length;
+    //不为 0 时，没有 RIFF 文件头的数据按这个采样率的裸 16 位单声道 PCM 处理
+    unsigned rawSampleRate;
+} AudioDecoderSource;
+
+typedef struct AudioDecoder AudioDecoder;
+
+typedef struct AudioDecoderOps {
+    const char *name;
+
+    //解码最多 frames 帧到 dst，返回实际的帧数，0 表示已经结束或者出错
+    unsigned (*read)(AudioDecoder *decoder, short *dst, unsigned frames);
+
+    void (*close)(AudioDecoder *decoder);
+} AudioDecoderOps;
+
+struct AudioDecoder {
+    const AudioDecoderOps *ops;
+    unsigned sampleRate;
+    //源的声道数
+    unsigned channels;
+    //为 true 时输出交错的立体声，否则输出单声道
+    bool stereo;
+    //总帧数，压缩格式按时长估计，可能和实际解码出的帧数差几毫秒；不知道时为 0
+    uint64_t frames;
+};
+
+//认得 source 的格式时返回打开的解码器，否则返回 NULL
+typedef AudioDecoder *(*AudioDecoderOpenFn)(const AudioDecoderSource *source);
+
+//RIFF/WAVE：8/16/24/32 位整数或 32 位 float，任意声道数；以及 rawSampleRate 指定的裸 PCM。
+//数据直接 mmap，读取时才转换
+AudioDecoder *audioDecoderOpenWav(const AudioDecoderSource *source);
+
+//依次尝试 openers，返回第一个打开成功的解码器
+AudioDecoder *audioDecoderOpen(const AudioDecoderSource *source,
+                               const AudioDecoderOpenFn *openers, unsigned count);
+
+//立体声的源改成输出交错的立体声，要在第一次读取前调用。源不是立体声时保持单声道，返回 false
+bool audioDecoderKeepStereo(AudioDecoder *decoder);
+
+//解码最多 frames 帧到 dst，立体声输出时 dst 要放得下 2 * frames 个样本
+unsigned audioDecoderRead(AudioDecoder *decoder, short *dst, unsigned frames);
+
+void audioDecoderClose(AudioDecoder *decoder);
+
+//解码器实现使用：把 channels 个声道交错的 int16 平均成单声道，dst 可以和 src 相同
+void audioDecoderDownmixS16(const short *src, unsigned channels, short *dst, unsigned frames);
+
+//解码器实现使用：把 channels 个声道交错的 int16 转换成交错的立体声。
+//单声道复制到两边，多于两个声道时取前两个（左前、右前）
+void audioDecoderStereoS16(const short *src, unsigned channels, short *dst, unsigned frames);
+
+#endif //NATIVEAUDIO_AUDIO_DECODER_H
@@ -0,0 +1,1460 @@
+#include "audio_engine.h"
+
+#include <math.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "callback_stats.h"
+#include "clip_cache.h"
+#include "clip_registry.h"
+#include "decoded_cache.h"
+#include "dsp_kernels.h"
+#include "mixer.h"
+#include "resampler.h"
+#include "reverb.h"
+#include "spsc_queue.h"
+
+typedef struct {
+    CaptureCallback chunk;
+    void *context;
+} CaptureConsumer;
+
+//音量/声像参数块：控制线程只写目标值，音频回调每个突发开始时读一次，
+//换算成每个声部组的左右增益交给混音器过渡
+typedef struct {
+    _Atomic float gain;
+    //-1（左）到 1（右）
+    _Atomic float pan;
+    //以下只在控制线程中使用：静音时 gain 为 0，取消静音后恢复为 level
+    float level;
+    bool muted;
+} GainParams;
+
+//控制线程 -> 音频回调线程的命令
+typedef enum {
+    //用一个新声部播放剪辑，已经在播放的剪辑继续播放
+    CMD_PLAY,
+    CMD_STOP,
+    //停止所有引用 refs 的声部
+    CMD_STOP_SOURCE,
+    CMD_SET_DITHER,
+    //打开或关闭混响并应用 reverb 中的设置
+    CMD_SET_REVERB,
+    //定时事件：把 group 的增益乘上 gain，从事件所在的帧开始过渡
+    CMD_SET_GROUP_GAIN,
+} PlayerCommandType;
+
+typedef struct {
+    PlayerCommandType type;
+    const short *buffer;
+    unsigned frames;
+    int count;
+    //为 NULL 时剪辑已经是输出采样率
+    const ResamplerFilter *filter;
+    //剪辑来自 clipCache 或调用方持有的 PCM 时指向它的引用计数
+    atomic_int *refs;
+    //filter 所在系数表条目的引用计数
+    atomic_int *filterRefs;
+    //buffer 还在渐进解码时指向已解码的帧数
+    const atomic_uint *ready;
+    //立体声资源：buffer 是左右声道各 frames 帧的两个平面，各用一个声部播放，
+    //refs 和 filterRefs 替两个声部各持有一个引用
+    bool stereo;
+    //循环区间，单位是 buffer 的帧；loopEnd 为 0 时整个剪辑循环 count 次
+    unsigned loopStart;
+    unsigned loopEnd;
+    unsigned crossfade;
+    int group;
+    float gain;
+    bool enabled;
+    ReverbSettings reverb;
+} PlayerCommand;
+
+#define PLAYER_COMMAND_CAPACITY 16
+
+//定时事件：在输出时钟的第 frame 帧执行 cmd
+typedef struct {
+    uint64_t frame;
+    PlayerCommand cmd;
+} ScheduledEvent;
+
+//还没到期的定时事件最多这么多，再多时留在队列里等前面的执行完
+#define SCHEDULED_EVENT_CAPACITY 64
+
+//剪辑重采样到输出采样率用的系数表，按 (源采样率, 输出采样率, 质量) 缓存。
+//表满时替换没有声部、在途命令或监听在用的最久未用条目
+#define MAX_CLIP_FILTERS 8
+
+typedef struct {
+    ResamplerFilter filter;
+    //正在使用它的声部、还没执行的命令和监听的数目，音频回调线程在声部结束时减一
+    atomic_int refs;
+    unsigned lastUse;
+} ClipFilter;
+
+#define CLIP_CACHE_BUDGET_BYTES (4 * 1024 * 1024)
+//解码后的资源比内置剪辑大得多：44.1 kHz 单声道 16 位一分钟约 5 MB，立体声加倍
+#define ASSET_CACHE_BUDGET_BYTES (32 * 1024 * 1024)
+
+#define MONITOR_RING_FRAMES 8192
+#define MONITOR_STAMPS 64
+#define MONITOR_SCRATCH_FRAMES 1024
+
+typedef struct {
+    //这块输入写完后 monitorRing 的写入位置
+    unsigned endFrame;
+    //录音回调收到这块输入的时刻，即最后一个样本的录制时刻
+    uint64_t timeNs;
+} MonitorStamp;
+
+//一个引擎实例的全部状态。各个实例互不共享任何可写数据，可以在不同的组件或线程里各自运行；
+//dsp 分派表是唯一的全局状态，它在加载时初始化后只读
+struct AudioEngine {
+    //录音是连续的流：录音回调每填满一小块就交给 audioEngineCaptureChunk，
+    //内置的消费者把它写进 recorderBuffer 环形区，只保留最近 recorderCapacity 帧作为 CLIP_PLAYBACK，
+    //其余消费者（例如写文件）拿到的是完整的流。环形区按最高存储采样率分配，
+    //修改采样率时不用释放可能还有声部在播放的缓冲区
+    short *recorderBuffer;
+    unsigned recorderRate;
+    unsigned recorderCapacity;
+    unsigned recorderFrames;
+    //录音回调下一次写入 recorderBuffer 的位置，以及这次录音一共收到的帧数
+    unsigned recorderWrite;
+    uint64_t recorderReceived;
+    //录音进行中时为 true，只由控制线程修改
+    atomic_bool recording;
+    //录音回调正在处理一块数据时非零，停止录音时等它归零后才整理 recorderBuffer
+    atomic_int captureActive;
+
+    //只在没有录音时修改，录音回调只读
+    CaptureConsumer captureConsumers[MAX_CAPTURE_CONSUMERS];
+    unsigned captureConsumerCount;
+
+    unsigned outputRate;
+    unsigned maxFrames;
+
+    //所有剪辑都作为声部混合进同一个输出流，几个剪辑可以同时播放。
+    //混音器只在音频回调线程中读写，控制线程通过 playerCommands 启停声部
+    Mixer mixer;
+    //一个突发大小的 float 立体声混音总线，输出是 float 时直接混进后端的缓冲区，不用它
+    float *mixBuffer;
+
+    GainParams masterParams;
+    GainParams groupParams[VOICE_GROUPS];
+    //资源的声道静音/独奏，只在控制线程中使用；换算出的每个声道是否可听（0 或 1）
+    //写进 channelGains，音频回调乘在 PCM 组和左右声道组的增益上
+    bool channelMuted[ASSET_MAX_CHANNELS];
+    bool channelSoloed[ASSET_MAX_CHANNELS];
+    _Atomic float channelGains[ASSET_MAX_CHANNELS];
+    atomic_uint rampMillis;
+    //audioEngineInit 重建混音器后第一个突发直接跳到目标值，不从默认值过渡
+    bool groupGainsValid;
+    //int16 输出级的抖动开关和噪声状态，只在音频回调线程中使用
+    bool ditherEnabled;
+    DspDither outputDither;
+
+    //混音总线上的混响，是 OpenSL 输出混音器混响（需要 SL_IID_EFFECTSEND，会让播放器失去快速音频）的替代。
+    //reverb 和 reverbEnabled 只在音频回调线程中使用（audioEngineInit 时回调没有运行）；
+    //关掉或者没有输入之后还要处理 reverbTail 帧，让尾音自然衰减完
+    Reverb reverb;
+    bool reverbEnabled;
+    unsigned reverbTail;
+    //控制线程保存的设置，重建 reverb 后重新应用
+    bool reverbRequested;
+    ReverbSettings reverbSettings;
+
+    SpscQueue playerCommands;
+
+    //定时事件：任意线程在 controlLock 下推进 scheduledEvents，音频回调每个突发开始时取出来，
+    //按帧号插入 pendingEvents（降序，最早的在末尾），渲染时在事件所在的帧切开突发，
+    //所以事件精确到样本，不受调用线程的抖动和突发边界影响
+    SpscQueue scheduledEvents;
+    ScheduledEvent pendingEvents[SCHEDULED_EVENT_CAPACITY];
+    unsigned pendingEventCount;
+    //输出时钟：已经渲染的帧数，也就是下一个突发第一帧的帧号
+    _Atomic uint64_t frameClock;
+    //定时增益事件设置的每组增益，只在音频回调线程中使用
+    float scheduledGains[VOICE_GROUPS];
+
+    //保护剪辑缓存、系数表和定时事件的生产者一侧，让定时函数可以在任意线程调用。
+    //音频回调从不获取它
+    pthread_mutex_t controlLock;
+
+    //音频回调线程可能还在使用旧的系数表，只有引用计数归零的条目才会被替换
+    ResamplerQuality resamplerQuality;
+    ClipFilter clipFilters[MAX_CLIP_FILTERS];
+    unsigned clipFilterCount;
+    unsigned filterUseCounter;
+
+    //转换到输出采样率的剪辑缓存，只在控制线程中访问（条目引用计数除外）
+    ClipCache clipCache;
+    bool clipCacheReady;
+
+    //解码后的资源，保持源采样率，由声部逐突发重采样，输出采样率变化时不用失效。在 controlLock 下访问
+    DecodedCache assetCache;
+    bool assetCacheReady;
+
+    //监听（录音 -> 播放回环）：录音回调把每块本机采样率的输入转换到输出采样率后写进 monitorRing，
+    //音频回调从中取出混进输出。每块输入附带一个时间戳，音频回调据此测量端到端延迟。
+    //每次 audioEngineStartMonitor 都递增 monitorGeneration，两边看到新的代号时各自重置自己的状态，
+    //所以控制线程从不直接改写两个实时线程正在使用的数据
+    SpscQueue monitorRing;
+    SpscQueue monitorStamps;
+    atomic_bool monitorEnabled;
+    atomic_uint monitorGeneration;
+    //只在监听关闭、录音回调不在运行时由控制线程修改，持有系数表条目的一个引用
+    ClipFilter *monitorFilter;
+    atomic_uint monitorOutputDelay;
+    //最近一块输入转换后的帧数，音频回调据此决定预缓冲多少
+    atomic_uint monitorChunkFrames;
+    _Atomic int64_t monitorStats[MONITOR_STATS_FIELDS];
+    _Atomic int64_t monitorLatencySum;
+
+    //录音回调线程
+    unsigned monitorProducerGeneration;
+    Resampler monitorResampler;
+    short monitorScratch[MONITOR_SCRATCH_FRAMES];
+
+    //音频回调线程
+    unsigned monitorConsumerGeneration;
+    bool monitorPrimed;
+    MonitorStamp monitorStamp;
+    bool monitorStampValid;
+    short *monitorS16;
+    float *monitorF32;
+};
+
+static void gainParamsInit(GainParams *params) {
+    atomic_init(&params->gain, 1.0f);
+    atomic_init(&params->pan, 0.0f);
+    params->level = 1.0f;
+    params->muted = false;
+}
+
+AudioEngine *audioEngineCreate(void) {
+    int group;
+    AudioEngine *engine = (AudioEngine *) calloc(1, sizeof(AudioEngine));
+    if (engine == NULL) {
+        return NULL;
+    }
+    engine->recorderBuffer = (short *) calloc(RECORDER_MAX_SAMPLE_RATE * RECORDER_SECONDS,
+                                              sizeof(short));
+    if (engine->recorderBuffer == NULL) {
+        free(engine);
+        return NULL;
+    }
+    engine->recorderRate = RECORDER_SAMPLE_RATE;
+    engine->recorderCapacity = RECORDER_SAMPLE_RATE * RECORDER_SECONDS;
+    gainParamsInit(&engine->masterParams);
+    for (group = 0; group < VOICE_GROUPS; ++group) {
+        gainParamsInit(&engine->groupParams[group]);
+        engine->scheduledGains[group] = 1.0f;
+    }
+    for (group = 0; group < ASSET_MAX_CHANNELS; ++group) {
+        atomic_init(&engine->channelGains[group], 1.0f);
+    }
+    pthread_mutex_init(&engine->controlLock, NULL);
+    atomic_init(&engine->rampMillis, DEFAULT_RAMP_MS);
+    engine->ditherEnabled = true;
+    engine->resamplerQuality = RESAMPLER_QUALITY_MEDIUM;
+    return engine;
+}
+
+void audioEngineDestroy(AudioEngine *engine) {
+    if (engine == NULL) {
+        return;
+    }
+    audioEngineShutdown(engine);
+    pthread_mutex_destroy(&engine->controlLock);
+    free(engine->recorderBuffer);
+    free(engine);
+}
+
+//等正在进行的 audioEngineCaptureChunk 返回，调用前先关掉它要检查的开关。
+//一块只要几十微秒，让出处理器而不是空转，录音线程和控制线程在同一个核上时也能很快轮到它
+static void waitCaptureIdle(AudioEngine *engine) {
+    while (atomic_load(&engine->captureActive) != 0) {
+        sched_yield();
+    }
+}
+
+//这段代码是在函数onDlOpen上面添加了一个特殊的属性__attribute__((constructor))，这个属性表示在函数初始化时会自动执行这个函数。
+// 因此，这个函数会在程序启动时自动执行。
+__attribute__((constructor)) static void onDlOpen(void) {
+    dspInit();
+}
+
+bool audioEngineInit(AudioEngine *engine, unsigned sampleRate, unsigned maxBurstFrames) {
+    if (!engine->clipCacheReady) {
+        clipCacheInit(&engine->clipCache, CLIP_CACHE_BUDGET_BYTES);
+        engine->clipCacheReady = true;
+    }
+    if (!engine->assetCacheReady) {
+        decodedCacheInit(&engine->assetCache, ASSET_CACHE_BUDGET_BYTES);
+        engine->assetCacheReady = true;
+    }
+    //缓存中的剪辑是按旧的输出采样率转换的
+    if (sampleRate != engine->outputRate) {
+        clipCacheInvalidate(&engine->clipCache, -1);
+    }
+
+    //延迟线长度按输出采样率分配
+    if (sampleRate != engine->reverb.sampleRate) {
+        reverbRelease(&engine->reverb);
+        if (!reverbInit(&engine->reverb, sampleRate)) {
+            return false;
+        }
+        if (engine->outputRate == 0) {
+            reverbPresetSettings(REVERB_PRESET_STONECORRIDOR, &engine->reverbSettings);
+        }
+        reverbSetSettings(&engine->reverb, &engine->reverbSettings);
+        engine->reverbEnabled = engine->reverbRequested;
+        engine->reverbTail = 0;
+    }
+    engine->outputRate = sampleRate;
+
+    if (maxBurstFrames != engine->maxFrames) {
+        free(engine->mixBuffer);
+        free(engine->monitorS16);
+        free(engine->monitorF32);
+        //正在播放的声部持有缓存条目、解码资源和映射文件的引用，先还回去再丢掉声部。
+        //后端已经停止，回调不会同时读写这些声部
+        mixerStopAll(&engine->mixer);
+        mixerRelease(&engine->mixer);
+        engine->mixBuffer = (float *) calloc(2 * maxBurstFrames, sizeof(float));
+        engine->groupGainsValid = false;
+        engine->monitorS16 = (short *) calloc(maxBurstFrames, sizeof(short));
+        engine->monitorF32 = (float *) calloc(maxBurstFrames, sizeof(float));
+        if (engine->mixBuffer == NULL || engine->monitorS16 == NULL || engine->monitorF32 == NULL ||
+            !mixerInit(&engine->mixer, maxBurstFrames)) {
+            engine->maxFrames = 0;
+            return false;
+        }
+        engine->maxFrames = maxBurstFrames;
+    }
+    if (engine->playerCommands.slots == NULL &&
+        !spscQueueInit(&engine->playerCommands, sizeof(PlayerCommand), PLAYER_COMMAND_CAPACITY)) {
+        return false;
+    }
+    if (engine->scheduledEvents.slots == NULL &&
+        !spscQueueInit(&engine->scheduledEvents, sizeof(ScheduledEvent),
+                       SCHEDULED_EVENT_CAPACITY)) {
+        return false;
+    }
+    //固定的种子，主机上同样的输入总是得到同样的输出
+    dspDitherInit(&engine->outputDither, 1);
+    return true;
+}
+
+//没有执行或者没有发出去的命令交还它持有的源 PCM 和系数表引用
+static void releaseCommand(const PlayerCommand *cmd) {
+    int held = cmd->stereo ? 2 : 1;
+    if (cmd->refs != NULL) {
+        atomic_fetch_sub_explicit(cmd->refs, held, memory_order_release);
+    }
+    if (cmd->filterRefs != NULL) {
+        atomic_fetch_sub_explicit(cmd->filterRefs, held, memory_order_release);
+    }
+}
+
+static void dropScheduledEvents(AudioEngine *engine) {
+    ScheduledEvent event;
+    while (engine->pendingEventCount > 0) {
+        releaseCommand(&engine->pendingEvents[--engine->pendingEventCount].cmd);
+    }
+    while (engine->scheduledEvents.slots != NULL &&
+           spscQueuePop(&engine->scheduledEvents, &event)) {
+        releaseCommand(&event.cmd);
+    }
+}
+
+void audioEngineShutdown(AudioEngine *engine) {
+    //后端已经停止，回调线程不会再运行，可以释放命令队列、剪辑缓存和系数表
+    pthread_mutex_lock(&engine->controlLock);
+    dropScheduledEvents(engine);
+    spscQueueRelease(&engine->scheduledEvents);
+    if (engine->clipCacheReady) {
+        clipCacheRelease(&engine->clipCache);
+        engine->clipCacheReady = false;
+    }
+    if (engine->assetCacheReady) {
+        decodedCacheRelease(&engine->assetCache);
+        engine->assetCacheReady = false;
+    }
+    spscQueueRelease(&engine->playerCommands);
+    atomic_store(&engine->monitorEnabled, false);
+    waitCaptureIdle(engine);
+    engine->monitorFilter = NULL;
+    spscQueueRelease(&engine->monitorRing);
+    spscQueueRelease(&engine->monitorStamps);
+    while (engine->clipFilterCount > 0) {
+        resamplerFilterRelease(&engine->clipFilters[--engine->clipFilterCount].filter);
+    }
+    free(engine->mixBuffer);
+    engine->mixBuffer = NULL;
+    free(engine->monitorS16);
+    engine->monitorS16 = NULL;
+    free(engine->monitorF32);
+    engine->monitorF32 = NULL;
+    reverbRelease(&engine->reverb);
+    engine->reverbEnabled = false;
+    engine->reverbRequested = false;
+    //还在播放的声部交还引用，调用方持有的 PCM 之后就可以释放
+    mixerStopAll(&engine->mixer);
+    mixerRelease(&engine->mixer);
+    engine->maxFrames = 0;
+    engine->outputRate = 0;
+    pthread_mutex_unlock(&engine->controlLock);
+}
+
+//只做指针和数值的交换
+static void applyPlayerCommand(AudioEngine *engine, const PlayerCommand *cmd) {
+    switch (cmd->type) {
+        case CMD_PLAY: {
+            //立体声资源的两个声部在同一个突发里开始，左右声道保持对齐
+            int channel, channels = cmd->stereo ? 2 : 1;
+            for (channel = 0; channel < channels; ++channel) {
+                int group = cmd->stereo ? VOICE_GROUP_PCM_LEFT + channel : cmd->group;
+                int voice = mixerPlay(&engine->mixer, cmd->buffer + (size_t) channel * cmd->frames,
+                                      cmd->frames, cmd->count, cmd->filter, 1.0f, group,
+                                      cmd->refs);
+                if (cmd->loopEnd != 0) {
+                    mixerSetVoiceLoop(&engine->mixer, voice, cmd->loopStart, cmd->loopEnd,
+                                      cmd->crossfade);
+                }
+                if (cmd->ready != NULL) {
+                    mixerSetVoiceReady(&engine->mixer, voice, cmd->ready);
+                }
+                if (cmd->filterRefs != NULL) {
+                    mixerSetVoiceFilterRefs(&engine->mixer, voice, cmd->filterRefs);
+                }
+            }
+            break;
+        }
+        case CMD_STOP:
+            mixerStopAll(&engine->mixer);
+            break;
+        case CMD_STOP_SOURCE:
+            mixerStopSource(&engine->mixer, cmd->refs);
+            break;
+        case CMD_SET_DITHER:
+            engine->ditherEnabled = cmd->enabled;
+            break;
+        case CMD_SET_REVERB:
+            reverbSetSettings(&engine->reverb, &cmd->reverb);
+            engine->reverbEnabled = cmd->enabled;
+            break;
+        case CMD_SET_GROUP_GAIN:
+            engine->scheduledGains[cmd->group] = cmd->gain;
+            break;
+    }
+}
+
+//每个突发开始时取出所有待处理命令
+static void drainPlayerCommands(AudioEngine *engine) {
+    PlayerCommand cmd;
+    while (spscQueuePop(&engine->playerCommands, &cmd)) {
+        applyPlayerCommand(engine, &cmd);
+    }
+}
+
+//把新到的定时事件按帧号插进 pendingEvents。帧号相同的按推送顺序执行，所以新事件排在它们前面
+static void receiveScheduledEvents(AudioEngine *engine) {
+    ScheduledEvent event;
+    while (engine->pendingEventCount < SCHEDULED_EVENT_CAPACITY &&
+           spscQueuePop(&engine->scheduledEvents, &event)) {
+        unsigned i = 0;
+        while (i < engine->pendingEventCount && engine->pendingEvents[i].frame > event.frame) {
+            ++i;
+        }
+        memmove(&engine->pendingEvents[i + 1], &engine->pendingEvents[i],
+                (engine->pendingEventCount - i) * sizeof(ScheduledEvent));
+        engine->pendingEvents[i] = event;
+        ++engine->pendingEventCount;
+    }
+}
+
+//执行帧号不晚于 now 的事件，已经错过的事件也在这里执行。有事件执行时返回 true
+static bool runDueEvents(AudioEngine *engine, uint64_t now) {
+    bool ran = false;
+    while (engine->pendingEventCount > 0 &&
+           engine->pendingEvents[engine->pendingEventCount - 1].frame <= now) {
+        applyPlayerCommand(engine, &engine->pendingEvents[--engine->pendingEventCount].cmd);
+        ran = true;
+    }
+    return ran;
+}
+
+//按平衡定律把增益和声像换算成左右增益：声像偏向哪边，另一边就按比例减小
+static void balanceGains(GainParams *params, unsigned channels, float *left, float *right) {
+    float gain = atomic_load_explicit(&params->gain, memory_order_relaxed);
+    float pan = channels == 2 ? atomic_load_explicit(&params->pan, memory_order_relaxed) : 0.0f;
+    *left = pan > 0.0f ? gain * (1.0f - pan) : gain;
+    *right = pan < 0.0f ? gain * (1.0f + pan) : gain;
+}
+
+//PCM 组里的资源再乘上声道静音/独奏：单声道的声部按声道 0；立体声资源的每个声道只送到自己那一侧，
+//单声道输出时两个声道各占一半，和解码器混成单声道的结果一样
+static void applyChannelGains(AudioEngine *engine, int group, unsigned channels, float *left,
+                              float *right) {
+    int channel = group == VOICE_GROUP_PCM_RIGHT;
+    float gain = atomic_load_explicit(&engine->channelGains[channel], memory_order_relaxed);
+    if (group == VOICE_GROUP_PCM) {
+        *left *= gain;
+        *right *= gain;
+    } else if (channels != 2) {
+        *left *= 0.5f * gain;
+    } else if (channel == 0) {
+        *left *= gain;
+        *right = 0.0f;
+    } else {
+        *left = 0.0f;
+        *right *= gain;
+    }
+}
+
+//音频回调线程：读参数块，每个声部组的目标增益是它自己的左右增益乘以主增益
+static void updateGroupGains(AudioEngine *engine, unsigned channels) {
+    unsigned ramp = engine->groupGainsValid ? engine->outputRate * atomic_load_explicit(
+            &engine->rampMillis, memory_order_relaxed) / 1000 : 0;
+    float masterLeft, masterRight;
+    int group;
+    balanceGains(&engine->masterParams, channels, &masterLeft, &masterRight);
+    for (group = 0; group < VOICE_GROUPS; ++group) {
+        bool assetChannel = group == VOICE_GROUP_PCM_LEFT || group == VOICE_GROUP_PCM_RIGHT;
+        int params = assetChannel ? VOICE_GROUP_PCM : group;
+        float left, right;
+        balanceGains(&engine->groupParams[params], channels, &left, &right);
+        if (params == VOICE_GROUP_PCM) {
+            applyChannelGains(engine, group, channels, &left, &right);
+        }
+        float scheduled = engine->scheduledGains[params];
+        mixerSetGroupGain(&engine->mixer, group, left * masterLeft * scheduled,
+                          right * masterRight * scheduled, ramp);
+    }
+    engine->groupGainsValid = true;
+}
+
+//音频回调线程：把监听输入叠加到 bus（accumulate 为 false 时直接覆盖），没有输出时返回 false
+static bool renderMonitor(AudioEngine *engine, float *bus, unsigned frames, unsigned channels,
+                          bool accumulate) {
+    if (!atomic_load_explicit(&engine->monitorEnabled, memory_order_acquire)) {
+        return false;
+    }
+    unsigned generation = atomic_load_explicit(&engine->monitorGeneration, memory_order_acquire);
+    if (generation != engine->monitorConsumerGeneration) {
+        //重新打开监听：上一次留下的数据和时间戳都过时了
+        spscQueueRead(&engine->monitorRing, NULL, MONITOR_RING_FRAMES);
+        while (spscQueuePop(&engine->monitorStamps, &engine->monitorStamp)) {
+        }
+        engine->monitorStampValid = false;
+        engine->monitorPrimed = false;
+        engine->monitorConsumerGeneration = generation;
+    }
+
+    //输入每次来一整块，至少要攒够一块加一个突发，才能在下一块到达之前一直有数据可取
+    unsigned fill = spscQueueSize(&engine->monitorRing);
+    unsigned prime = frames + atomic_load_explicit(&engine->monitorChunkFrames,
+                                                   memory_order_relaxed);
+    if (!engine->monitorPrimed) {
+        if (fill < prime) {
+            return false;
+        }
+        engine->monitorPrimed = true;
+    }
+    //输入和输出的时钟有偏差时积压会慢慢变多，超过两倍预缓冲量就丢掉多余的，把延迟拉回来
+    if (fill > 2 * prime) {
+        unsigned discard = spscQueueRead(&engine->monitorRing, NULL, fill - prime);
+        atomic_fetch_add_explicit(&engine->monitorStats[MONITOR_STATS_DROPPED_FRAMES], discard,
+                                  memory_order_relaxed);
+        fill -= discard;
+    }
+    atomic_store_explicit(&engine->monitorStats[MONITOR_STATS_BUFFERED_FRAMES], fill,
+                          memory_order_relaxed);
+
+    //这个突发第一个样本所在的那块输入：endFrame 在它之后的第一个时间戳
+    unsigned position = atomic_load_explicit(&engine->monitorRing.head, memory_order_relaxed);
+    while ((!engine->monitorStampValid || (int) (engine->monitorStamp.endFrame - position) <= 0) &&
+           spscQueuePop(&engine->monitorStamps, &engine->monitorStamp)) {
+        engine->monitorStampValid = true;
+    }
+    if (engine->monitorStampValid && (int) (engine->monitorStamp.endFrame - position) > 0) {
+        //录制时刻按样本在块内的位置往前推；播放时刻是设备队列里已有的数据播完之后
+        int64_t captured = (int64_t) engine->monitorStamp.timeNs -
+                           (int64_t) (engine->monitorStamp.endFrame - position) * 1000000000 /
+                           engine->outputRate;
+        unsigned delay = atomic_load_explicit(&engine->monitorOutputDelay, memory_order_relaxed);
+        int64_t played = (int64_t) callbackStatsNow() +
+                         (int64_t) delay * 1000000000 / engine->outputRate;
+        int64_t latency = played - captured;
+        atomic_store_explicit(&engine->monitorStats[MONITOR_STATS_LATENCY_NS], latency,
+                              memory_order_relaxed);
+        if (latency < atomic_load_explicit(&engine->monitorStats[MONITOR_STATS_MIN_LATENCY_NS],
+                                           memory_order_relaxed)) {
+            atomic_store_explicit(&engine->monitorStats[MONITOR_STATS_MIN_LATENCY_NS], latency,
+                                  memory_order_relaxed);
+        }
+        if (latency > atomic_load_explicit(&engine->monitorStats[MONITOR_STATS_MAX_LATENCY_NS],
+                                           memory_order_relaxed)) {
+            atomic_store_explicit(&engine->monitorStats[MONITOR_STATS_MAX_LATENCY_NS], latency,
+                                  memory_order_relaxed);
+        }
+        atomic_fetch_add_explicit(&engine->monitorLatencySum, latency, memory_order_relaxed);
+        atomic_fetch_add_explicit(&engine->monitorStats[MONITOR_STATS_MEASUREMENTS], 1,
+                                  memory_order_relaxed);
+    }
+
+    unsigned got = spscQueueRead(&engine->monitorRing, engine->monitorS16, frames);
+    if (got < frames) {
+        //输入没跟上：缺的部分补静音，重新预缓冲
+        memset(engine->monitorS16 + got, 0, (frames - got) * sizeof(short));
+        atomic_fetch_add_explicit(&engine->monitorStats[MONITOR_STATS_UNDERRUNS], 1,
+                                  memory_order_relaxed);
+        engine->monitorPrimed = false;
+    }
+    dsp->s16ToF32(engine->monitorS16, engine->monitorF32, frames);
+    if (!accumulate) {
+        memset(bus, 0, frames * channels * sizeof(float));
+    }
+    mixerMixGroup(&engine->mixer, VOICE_GROUP_MONITOR, bus, engine->monitorF32, frames, channels,
+                  1.0f);
+    return true;
+}
+
+//音频回调线程：总线上有声音（input）且混响打开时送进混响，否则只输出剩下的尾音。
+//没有输入时 bus 还没写过，先清零；尾音结束后返回 false 且不碰 bus
+static bool renderReverb(AudioEngine *engine, float *bus, unsigned frames, unsigned channels,
+                         bool input) {
+    bool feed = engine->reverbEnabled && input;
+    if (feed) {
+        engine->reverbTail = engine->reverb.tailFrames;
+    } else if (engine->reverbTail == 0) {
+        return false;
+    }
+    if (!input) {
+        memset(bus, 0, frames * channels * sizeof(float));
+    }
+    reverbProcess(&engine->reverb, bus, frames, channels, feed);
+    if (!feed) {
+        engine->reverbTail = engine->reverbTail > frames ? engine->reverbTail - frames : 0;
+        if (engine->reverbTail == 0) {
+            //清掉残留的微小数值，之后再打开时从静音开始
+            reverbReset(&engine->reverb);
+        }
+    }
+    return true;
+}
+
+void audioEngineRender(void *context, void *dst, unsigned frames, unsigned channels,
+                       AudioSampleFormat format) {
+    AudioEngine *engine = (AudioEngine *) context;
+    uint64_t clock = atomic_load_explicit(&engine->frameClock, memory_order_relaxed);
+    drainPlayerCommands(engine);
+    receiveScheduledEvents(engine);
+    runDueEvents(engine, clock);
+    updateGroupGains(engine, channels);
+    //把所有声部和监听输入按各自组的增益（已经乘上主增益和声像）混合到 float 总线上，
+    //再按后端的格式输出。总线上的和可以超出 [-1, 1)，只有最后转换成 int16 时才饱和
+    float *bus = format == AUDIO_FORMAT_FLOAT ? (float *) dst : engine->mixBuffer;
+    unsigned samples = frames * channels;
+    bool monitor = renderMonitor(engine, bus, frames, channels, false);
+    bool voices = false;
+    unsigned done = 0;
+    //下一个定时事件落在这个突发里时只渲染到它之前，执行完再继续，声部在事件所在的帧开始或停止
+    while (done < frames) {
+        unsigned segment = frames - done;
+        if (engine->pendingEventCount > 0) {
+            uint64_t next = engine->pendingEvents[engine->pendingEventCount - 1].frame;
+            if (next < clock + frames) {
+                segment = (unsigned) (next - clock) - done;
+            }
+        }
+        if (mixerActiveVoices(&engine->mixer) != 0) {
+            if (!voices && !monitor) {
+                memset(bus, 0, samples * sizeof(float));
+            }
+            voices = true;
+            mixerRender(&engine->mixer, bus + done * channels, segment, channels);
+        }
+        //没有声音时增益照样过渡，之后开始的声部从新的增益开始
+        mixerAdvanceGroups(&engine->mixer, segment);
+        done += segment;
+        if (done < frames && runDueEvents(engine, clock + done)) {
+            updateGroupGains(engine, channels);
+        }
+    }
+    atomic_store_explicit(&engine->frameClock, clock + frames, memory_order_relaxed);
+    bool wet = renderReverb(engine, bus, frames, channels, monitor || voices);
+    if (!monitor && !voices && !wet) {
+        memset(dst, 0, samples * audioSampleBytes(format));
+        return;
+    }
+    //float 输出不截断，超出满幅的部分由系统混音器处理
+    if (format == AUDIO_FORMAT_S16) {
+        if (engine->ditherEnabled) {
+            dsp->f32ToS16Dither(bus, (short *) dst, samples, &engine->outputDither);
+        } else {
+            dsp->f32ToS16(bus, (short *) dst, samples);
+        }
+    }
+}
+
+//取得 inRate -> 输出采样率的系数表，第一次用到时生成。表满时替换引用计数为零的最久未用条目，
+//调用方要用它时再 holdFilter。返回 NULL 表示不需要重采样；生成失败时也返回 NULL 并把 *ok 置为 false
+static ClipFilter *getClipFilter(AudioEngine *engine, unsigned inRate, bool *ok) {
+    ClipFilter *slot = NULL;
+    unsigned i;
+    *ok = true;
+    if (inRate == engine->outputRate) {
+        return NULL;
+    }
+    for (i = 0; i < engine->clipFilterCount; ++i) {
+        ClipFilter *entry = &engine->clipFilters[i];
+        if (entry->filter.inRate == inRate && entry->filter.outRate == engine->outputRate &&
+            entry->filter.quality == engine->resamplerQuality) {
+            entry->lastUse = ++engine->filterUseCounter;
+            return entry;
+        }
+    }
+    if (engine->clipFilterCount < MAX_CLIP_FILTERS) {
+        slot = &engine->clipFilters[engine->clipFilterCount];
+    } else {
+        for (i = 0; i < MAX_CLIP_FILTERS; ++i) {
+            ClipFilter *entry = &engine->clipFilters[i];
+            if (atomic_load_explicit(&entry->refs, memory_order_acquire) == 0 &&
+                (slot == NULL || entry->lastUse < slot->lastUse)) {
+                slot = entry;
+            }
+        }
+        if (slot != NULL) {
+            resamplerFilterRelease(&slot->filter);
+        }
+    }
+    //生成失败时被替换的条目保持清零，不会再匹配任何采样率，下次优先重用
+    if (slot == NULL || !resamplerFilterInit(&slot->filter, inRate, engine->outputRate,
+                                             engine->resamplerQuality)) {
+        *ok = false;
+        return NULL;
+    }
+    if (slot == &engine->clipFilters[engine->clipFilterCount]) {
+        ++engine->clipFilterCount;
+    }
+    atomic_store_explicit(&slot->refs, 0, memory_order_relaxed);
+    slot->lastUse = ++engine->filterUseCounter;
+    return slot;
+}
+
+//命令带着系数表交给音频回调时替它加一个引用，声部结束时交还
+static void holdFilter(PlayerCommand *cmd, ClipFilter *filter) {
+    cmd->filter = &filter->filter;
+    cmd->filterRefs = &filter->refs;
+    atomic_fetch_add_explicit(&filter->refs, 1, memory_order_relaxed);
+}
+
+void audioEngineSetResamplerQuality(AudioEngine *engine, int quality) {
+    if (quality < RESAMPLER_QUALITY_LOW || quality > RESAMPLER_QUALITY_HIGH) {
+        return;
+    }
+    //之后选择的剪辑按新的质量生成系数表，正在播放的剪辑不受影响
+    pthread_mutex_lock(&engine->controlLock);
+    engine->resamplerQuality = (ResamplerQuality) quality;
+    if (engine->clipCacheReady) {
+        clipCacheInvalidate(&engine->clipCache, -1);
+    }
+    pthread_mutex_unlock(&engine->controlLock);
+}
+
+void audioEngineSetClipCacheBudget(AudioEngine *engine, size_t budgetBytes) {
+    pthread_mutex_lock(&engine->controlLock);
+    if (engine->clipCacheReady) {
+        clipCacheSetBudget(&engine->clipCache, budgetBytes);
+    }
+    pthread_mutex_unlock(&engine->controlLock);
+}
+
+//在 controlLock 下把剪辑准备成一条 CMD_PLAY（CLIP_NONE 或空剪辑时是 CMD_STOP）。
+//剪辑第一次播放时转换到输出采样率并放进 clipCache，之后重新触发只是交出指针；
+//缓存放不下时保持原始采样率，由回调在每个突发里重采样。*entry 是 cmd 持有引用的缓存条目
+static bool prepareClip(AudioEngine *engine, int which, int count, const ClipLoop *loop,
+                        PlayerCommand *cmd, ClipCacheEntry **entry) {
+    unsigned srcRate = 0;
+    unsigned srcFrames = 0;
+    memset(cmd, 0, sizeof(PlayerCommand));
+    cmd->type = CMD_PLAY;
+    *entry = NULL;
+    //剪辑至少播放一次，只有循环区间可以一直重复
+    cmd->count = count > 0 ? count : loop != NULL && count < 0 ? MIXER_LOOP_FOREVER : 1;
+    cmd->group = VOICE_GROUP_CLIPS;
+
+    switch (which) {
+        case CLIP_NONE:
+            break;
+
+        case CLIP_PLAYBACK:
+            //录音还没结束，recorderBuffer 还不能播放
+            if (atomic_load_explicit(&engine->recording, memory_order_acquire)) {
+                return false;
+            }
+            cmd->buffer = engine->recorderBuffer;
+            cmd->frames = engine->recorderFrames;
+            srcRate = engine->recorderRate;
+            srcFrames = cmd->frames;
+            break;
+
+        default: {
+            //内置剪辑：优先用构建时为输出采样率转换好的版本，这时不需要缓存也不需要重采样
+            const ClipVariant *source = clipRegistrySource(which);
+            const ClipVariant *clip = clipRegistryFind(which, engine->outputRate);
+            if (clip == NULL) {
+                clip = source;
+            }
+            if (clip != NULL) {
+                cmd->buffer = clip->pcm;
+                cmd->frames = clip->frames;
+                srcRate = clip->sampleRate;
+                srcFrames = source->frames;
+            }
+            break;
+        }
+    }
+    if (cmd->frames == 0) {
+        cmd->type = CMD_STOP;
+        return true;
+    }
+    bool ok;
+    ClipFilter *filter = getClipFilter(engine, srcRate, &ok);
+    if (!ok) {
+        return false;
+    }
+    if (filter != NULL && engine->clipCacheReady) {
+        *entry = clipCacheAcquire(&engine->clipCache, which, filter->filter.outRate);
+        if (*entry == NULL) {
+            *entry = clipCacheInsert(&engine->clipCache, which, cmd->buffer, cmd->frames,
+                                     &filter->filter);
+        }
+    }
+    if (*entry != NULL) {
+        cmd->buffer = (*entry)->pcm;
+        cmd->frames = (*entry)->frames;
+        cmd->refs = &(*entry)->refs;
+    } else if (filter != NULL) {
+        holdFilter(cmd, filter);
+    }
+    //循环点按剪辑原来的帧给出，剪辑已经转换到输出采样率时按长度换算
+    if (loop != NULL && loop->end > loop->start) {
+        cmd->loopStart = (unsigned) ((uint64_t) loop->start * cmd->frames / srcFrames);
+        cmd->loopEnd = (unsigned) ((uint64_t) loop->end * cmd->frames / srcFrames);
+        cmd->crossfade = (unsigned) ((uint64_t) loop->crossfade * cmd->frames / srcFrames);
+    }
+    return true;
+}
+
+bool audioEngineSelectClip(AudioEngine *engine, int which, int count) {
+    return audioEngineSelectClipLoop(engine, which, count, NULL);
+}
+
+bool audioEngineSelectClipLoop(AudioEngine *engine, int which, int count,
+                               const ClipLoop *loop) {
+    //选择剪辑只是向音频回调线程发一条命令，不会阻塞，也不需要客户端重试
+    PlayerCommand cmd;
+    ClipCacheEntry *entry;
+    if (engine->playerCommands.slots == NULL) {
+        return false;
+    }
+    pthread_mutex_lock(&engine->controlLock);
+    bool ok = prepareClip(engine, which, count, loop, &cmd, &entry);
+    //回调线程已经积压了 PLAYER_COMMAND_CAPACITY 条命令，说明输出流没有在运行
+    if (ok && !spscQueuePush(&engine->playerCommands, &cmd)) {
+        releaseCommand(&cmd);
+        ok = false;
+    }
+    pthread_mutex_unlock(&engine->controlLock);
+    return ok;
+}
+
+//在 controlLock 下准备播放调用方 PCM 的命令，refs 不为 NULL 时已经替命令加上引用，系数表也一样
+static bool preparePcm(AudioEngine *engine, const short *pcm, unsigned frames,
+                       unsigned sampleRate, int count, atomic_int *refs, PlayerCommand *cmd) {
+    bool ok;
+    memset(cmd, 0, sizeof(PlayerCommand));
+    cmd->type = CMD_PLAY;
+    if (pcm == NULL || frames == 0 || count <= 0) {
+        return false;
+    }
+    //不进 clipCache：源数据留在调用方的内存里，采样率不同时由声部逐突发重采样
+    ClipFilter *filter = getClipFilter(engine, sampleRate, &ok);
+    if (!ok) {
+        return false;
+    }
+    if (filter != NULL) {
+        holdFilter(cmd, filter);
+    }
+    cmd->buffer = pcm;
+    cmd->frames = frames;
+    cmd->count = count;
+    cmd->group = VOICE_GROUP_PCM;
+    cmd->refs = refs;
+    if (refs != NULL) {
+        atomic_fetch_add_explicit(refs, 1, memory_order_relaxed);
+    }
+    return true;
+}
+
+bool audioEnginePlayPcm(AudioEngine *engine, const short *pcm, unsigned frames,
+                        unsigned sampleRate, int count, atomic_int *refs) {
+    PlayerCommand cmd;
+    pthread_mutex_lock(&engine->controlLock);
+    bool ok = preparePcm(engine, pcm, frames, sampleRate, count, refs, &cmd);
+    if (ok && !spscQueuePush(&engine->playerCommands, &cmd)) {
+        releaseCommand(&cmd);
+        ok = false;
+    }
+    pthread_mutex_unlock(&engine->controlLock);
+    return ok;
+}
+
+bool audioEngineStopPcm(AudioEngine *engine, atomic_int *refs) {
+    PlayerCommand cmd = {CMD_STOP_SOURCE};
+    cmd.refs = refs;
+    if (refs == NULL) {
+        return false;
+    }
+    pthread_mutex_lock(&engine->controlLock);
+    bool ok = spscQueuePush(&engine->playerCommands, &cmd);
+    pthread_mutex_unlock(&engine->controlLock);
+    return ok;
+}
+
+bool audioEngineLoadAsset(AudioEngine *engine, const char *key, AudioDecoder *decoder,
+                          bool progressive) {
+    bool ok = false;
+    pthread_mutex_lock(&engine->controlLock);
+    if (!engine->assetCacheReady || decodedCacheFind(&engine->assetCache, key) != NULL) {
+        ok = engine->assetCacheReady;
+        audioDecoderClose(decoder);
+    } else {
+        DecodedAsset *asset = decodedCacheInsert(&engine->assetCache, key, decoder, progressive);
+        if (asset != NULL) {
+            decodedCacheUnref(asset);
+            ok = true;
+        }
+    }
+    pthread_mutex_unlock(&engine->controlLock);
+    return ok;
+}
+
+bool audioEngineHasAsset(AudioEngine *engine, const char *key) {
+    return audioEngineAssetChannels(engine, key) > 0;
+}
+
+unsigned audioEngineAssetChannels(AudioEngine *engine, const char *key) {
+    pthread_mutex_lock(&engine->controlLock);
+    DecodedAsset *asset = engine->assetCacheReady ? decodedCacheFind(&engine->assetCache, key)
+                                                  : NULL;
+    unsigned channels = asset != NULL ? asset->channels : 0;
+    pthread_mutex_unlock(&engine->controlLock);
+    return channels;
+}
+
+//在 controlLock 下准备播放已解码资源的命令，*asset 是 cmd 持有引用的条目
+static bool prepareAsset(AudioEngine *engine, const char *key, int count, PlayerCommand *cmd,
+                         DecodedAsset **asset) {
+    *asset = engine->assetCacheReady ? decodedCacheAcquire(&engine->assetCache, key) : NULL;
+    if (*asset == NULL) {
+        return false;
+    }
+    if (!preparePcm(engine, (*asset)->pcm, (*asset)->frames, (*asset)->sampleRate, count, NULL,
+                    cmd)) {
+        decodedCacheUnref(*asset);
+        return false;
+    }
+    cmd->refs = &(*asset)->refs;
+    cmd->ready = &(*asset)->ready;
+    //第二个声部的引用
+    cmd->stereo = (*asset)->channels == 2;
+    if (cmd->stereo) {
+        atomic_fetch_add_explicit(cmd->refs, 1, memory_order_relaxed);
+        if (cmd->filterRefs != NULL) {
+            atomic_fetch_add_explicit(cmd->filterRefs, 1, memory_order_relaxed);
+        }
+    }
+    return true;
+}
+
+bool audioEnginePlayAsset(AudioEngine *engine, const char *key, int count) {
+    PlayerCommand cmd;
+    DecodedAsset *asset;
+    pthread_mutex_lock(&engine->controlLock);
+    bool ok = prepareAsset(engine, key, count, &cmd, &asset);
+    if (ok && !spscQueuePush(&engine->playerCommands, &cmd)) {
+        releaseCommand(&cmd);
+        ok = false;
+    }
+    pthread_mutex_unlock(&engine->controlLock);
+    return ok;
+}
+
+bool audioEngineStopAsset(AudioEngine *engine, const char *key) {
+    PlayerCommand cmd = {CMD_STOP_SOURCE};
+    pthread_mutex_lock(&engine->controlLock);
+    DecodedAsset *asset = engine->assetCacheReady ? decodedCacheFind(&engine->assetCache, key)
+                                                  : NULL;
+    if (asset != NULL) {
+        cmd.refs = &asset->refs;
+    }
+    bool ok = asset != NULL && spscQueuePush(&engine->playerCommands, &cmd);
+    pthread_mutex_unlock(&engine->controlLock);
+    return ok;
+}
+
+void audioEngineSetAssetCacheBudget(AudioEngine *engine, size_t budgetBytes) {
+    pthread_mutex_lock(&engine->controlLock);
+    if (engine->assetCacheReady) {
+        decodedCacheSetBudget(&engine->assetCache, budgetBytes);
+    }
+    pthread_mutex_unlock(&engine->controlLock);
+}
+
+uint64_t audioEngineFrameTime(AudioEngine *engine) {
+    return atomic_load_explicit(&engine->frameClock, memory_order_relaxed);
+}
+
+//在 controlLock 下推送一个定时事件。队列满时不替事件释放引用，由调用方处理
+static bool pushScheduledEvent(AudioEngine *engine, uint64_t frame, const PlayerCommand *cmd) {
+    ScheduledEvent event;
+    event.frame = frame;
+    event.cmd = *cmd;
+    return engine->scheduledEvents.slots != NULL &&
+           spscQueuePush(&engine->scheduledEvents, &event);
+}
+
+bool audioEngineScheduleClip(AudioEngine *engine, uint64_t frame, int which, int count,
+                             const ClipLoop *loop) {
+    PlayerCommand cmd;
+    ClipCacheEntry *entry;
+    pthread_mutex_lock(&engine->controlLock);
+    bool ok = engine->scheduledEvents.slots != NULL &&
+              prepareClip(engine, which, count, loop, &cmd, &entry);
+    if (ok && !pushScheduledEvent(engine, frame, &cmd)) {
+        releaseCommand(&cmd);
+        ok = false;
+    }
+    pthread_mutex_unlock(&engine->controlLock);
+    return ok;
+}
+
+bool audioEngineSchedulePcm(AudioEngine *engine, uint64_t frame, const short *pcm,
+                            unsigned frames, unsigned sampleRate, int count, atomic_int *refs) {
+    PlayerCommand cmd;
+    pthread_mutex_lock(&engine->controlLock);
+    bool ok = engine->scheduledEvents.slots != NULL &&
+              preparePcm(engine, pcm, frames, sampleRate, count, refs, &cmd);
+    if (ok && !pushScheduledEvent(engine, frame, &cmd)) {
+        releaseCommand(&cmd);
+        ok = false;
+    }
+    pthread_mutex_unlock(&engine->controlLock);
+    return ok;
+}
+
+bool audioEngineScheduleAsset(AudioEngine *engine, uint64_t frame, const char *key, int count) {
+    PlayerCommand cmd;
+    DecodedAsset *asset;
+    pthread_mutex_lock(&engine->controlLock);
+    bool ok = engine->scheduledEvents.slots != NULL &&
+              prepareAsset(engine, key, count, &cmd, &asset);
+    if (ok && !pushScheduledEvent(engine, frame, &cmd)) {
+        releaseCommand(&cmd);
+        ok = false;
+    }
+    pthread_mutex_unlock(&engine->controlLock);
+    return ok;
+}
+
+bool audioEngineScheduleStop(AudioEngine *engine, uint64_t frame) {
+    PlayerCommand cmd = {CMD_STOP};
+    pthread_mutex_lock(&engine->controlLock);
+    bool ok = pushScheduledEvent(engine, frame, &cmd);
+    pthread_mutex_unlock(&engine->controlLock);
+    return ok;
+}
+
+//主增益由回调线程直接作用在样本上
+static float millibelToGain(int millibel) {
+    return powf(10.0f, millibel / 2000.0f);
+}
+
+bool audioEngineScheduleGroupVolume(AudioEngine *engine, uint64_t frame, int group,
+                                    int millibel) {
+    PlayerCommand cmd = {CMD_SET_GROUP_GAIN};
+    if (group < 0 || group >= VOICE_GROUPS) {
+        return false;
+    }
+    cmd.group = group;
+    cmd.gain = millibelToGain(millibel);
+    pthread_mutex_lock(&engine->controlLock);
+    bool ok = pushScheduledEvent(engine, frame, &cmd);
+    pthread_mutex_unlock(&engine->controlLock);
+    return ok;
+}
+
+static void setLevel(GainParams *params, float level, bool muted) {
+    params->level = level;
+    params->muted = muted;
+    atomic_store_explicit(&params->gain, muted ? 0.0f : level, memory_order_relaxed);
+}
+
+static void setPan(GainParams *params, int permille) {
+    float pan = permille < -1000 ? -1.0f : permille > 1000 ? 1.0f : permille / 1000.0f;
+    atomic_store_explicit(&params->pan, pan, memory_order_relaxed);
+}
+
+void audioEngineSetVolume(AudioEngine *engine, int millibel) {
+    setLevel(&engine->masterParams, millibelToGain(millibel), engine->masterParams.muted);
+}
+
+void audioEngineSetMute(AudioEngine *engine, bool mute) {
+    setLevel(&engine->masterParams, engine->masterParams.level, mute);
+}
+
+void audioEngineSetPan(AudioEngine *engine, int permille) {
+    setPan(&engine->masterParams, permille);
+}
+
+void audioEngineSetGroupVolume(AudioEngine *engine, int group, int millibel) {
+    if (group >= 0 && group < VOICE_GROUPS) {
+        setLevel(&engine->groupParams[group], millibelToGain(millibel),
+                 engine->groupParams[group].muted);
+    }
+}
+
+void audioEngineSetGroupMute(AudioEngine *engine, int group, bool mute) {
+    if (group >= 0 && group < VOICE_GROUPS) {
+        setLevel(&engine->groupParams[group], engine->groupParams[group].level, mute);
+    }
+}
+
+void audioEngineSetGroupPan(AudioEngine *engine, int group, int permille) {
+    if (group >= 0 && group < VOICE_GROUPS) {
+        setPan(&engine->groupParams[group], permille);
+    }
+}
+
+//有声道独奏时只有独奏的声道可听，静音的声道总是不可听
+static void updateChannelGains(AudioEngine *engine) {
+    bool soloed = false;
+    int channel;
+    for (channel = 0; channel < ASSET_MAX_CHANNELS; ++channel) {
+        soloed = soloed || engine->channelSoloed[channel];
+    }
+    for (channel = 0; channel < ASSET_MAX_CHANNELS; ++channel) {
+        bool audible = !engine->channelMuted[channel] &&
+                       (!soloed || engine->channelSoloed[channel]);
+        atomic_store_explicit(&engine->channelGains[channel], audible ? 1.0f : 0.0f,
+                              memory_order_relaxed);
+    }
+}
+
+void audioEngineSetChannelMute(AudioEngine *engine, unsigned channel, bool mute) {
+    if (channel < ASSET_MAX_CHANNELS) {
+        engine->channelMuted[channel] = mute;
+        updateChannelGains(engine);
+    }
+}
+
+void audioEngineSetChannelSolo(AudioEngine *engine, unsigned channel, bool solo) {
+    if (channel < ASSET_MAX_CHANNELS) {
+        engine->channelSoloed[channel] = solo;
+        updateChannelGains(engine);
+    }
+}
+
+void audioEngineSetRampTime(AudioEngine *engine, unsigned milliseconds) {
+    atomic_store_explicit(&engine->rampMillis, milliseconds, memory_order_relaxed);
+}
+
+void audioEngineSetDither(AudioEngine *engine, bool enabled) {
+    PlayerCommand cmd = {CMD_SET_DITHER};
+    cmd.enabled = enabled;
+    pthread_mutex_lock(&engine->controlLock);
+    if (engine->playerCommands.slots != NULL) {
+        spscQueuePush(&engine->playerCommands, &cmd);
+    }
+    pthread_mutex_unlock(&engine->controlLock);
+}
+
+//调用方持有 controlLock，混响设置和命令队列的生产端都由它保护
+static void sendReverb(AudioEngine *engine) {
+    PlayerCommand cmd = {CMD_SET_REVERB};
+    cmd.enabled = engine->reverbRequested;
+    cmd.reverb = engine->reverbSettings;
+    if (engine->playerCommands.slots != NULL) {
+        spscQueuePush(&engine->playerCommands, &cmd);
+    }
+}
+
+void audioEngineEnableReverb(AudioEngine *engine, bool enabled) {
+    pthread_mutex_lock(&engine->controlLock);
+    engine->reverbRequested = enabled;
+    sendReverb(engine);
+    pthread_mutex_unlock(&engine->controlLock);
+}
+
+bool audioEngineSetReverbPreset(AudioEngine *engine, int preset) {
+    pthread_mutex_lock(&engine->controlLock);
+    bool ok = reverbPresetSettings(preset, &engine->reverbSettings);
+    if (ok) {
+        sendReverb(engine);
+    }
+    pthread_mutex_unlock(&engine->controlLock);
+    return ok;
+}
+
+void audioEngineSetReverbSettings(AudioEngine *engine, const ReverbSettings *settings) {
+    pthread_mutex_lock(&engine->controlLock);
+    engine->reverbSettings = *settings;
+    sendReverb(engine);
+    pthread_mutex_unlock(&engine->controlLock);
+}
+
+bool audioEngineAddCaptureConsumer(AudioEngine *engine, CaptureCallback chunk, void *context) {
+    if (atomic_load(&engine->recording) || engine->captureConsumerCount == MAX_CAPTURE_CONSUMERS) {
+        return false;
+    }
+    engine->captureConsumers[engine->captureConsumerCount].chunk = chunk;
+    engine->captureConsumers[engine->captureConsumerCount].context = context;
+    ++engine->captureConsumerCount;
+    return true;
+}
+
+bool audioEngineRemoveCaptureConsumer(AudioEngine *engine, CaptureCallback chunk, void *context) {
+    unsigned i;
+    if (atomic_load(&engine->recording)) {
+        return false;
+    }
+    for (i = 0; i < engine->captureConsumerCount; ++i) {
+        if (engine->captureConsumers[i].chunk == chunk &&
+            engine->captureConsumers[i].context == context) {
+            engine->captureConsumers[i] = engine->captureConsumers[--engine->captureConsumerCount];
+            return true;
+        }
+    }
+    return false;
+}
+
+bool audioEngineSetRecorderRate(AudioEngine *engine, unsigned sampleRate) {
+    if (sampleRate == 0 || sampleRate > RECORDER_MAX_SAMPLE_RATE ||
+        atomic_load(&engine->recording) || atomic_load(&engine->monitorEnabled)) {
+        return false;
+    }
+    if (sampleRate != engine->recorderRate) {
+        //旧录音按旧采样率存储，不能再当作 CLIP_PLAYBACK
+        engine->recorderRate = sampleRate;
+        engine->recorderCapacity = sampleRate * RECORDER_SECONDS;
+        engine->recorderFrames = 0;
+        if (engine->clipCacheReady) {
+            clipCacheInvalidate(&engine->clipCache, CLIP_PLAYBACK);
+        }
+    }
+    return true;
+}
+
+unsigned audioEngineRecorderRate(AudioEngine *engine) {
+    return engine->recorderRate;
+}
+
+void audioEngineRecordingStarted(AudioEngine *engine) {
+    //缓冲区尚不能播放
+    atomic_store(&engine->recording, true);
+    engine->recorderFrames = 0;
+    engine->recorderWrite = 0;
+    engine->recorderReceived = 0;
+    //缓存里的旧录音已经过时，正在播放它的声部播完后再释放
+    if (engine->clipCacheReady) {
+        clipCacheInvalidate(&engine->clipCache, CLIP_PLAYBACK);
+    }
+}
+
+//录音回调线程：把一块输入转换到输出采样率写进 monitorRing，放不下的部分丢弃
+static void monitorCapture(AudioEngine *engine, const short *pcm, unsigned frames) {
+    if (!atomic_load_explicit(&engine->monitorEnabled, memory_order_acquire)) {
+        return;
+    }
+    uint64_t arrival = callbackStatsNow();
+    unsigned generation = atomic_load_explicit(&engine->monitorGeneration, memory_order_acquire);
+    const ResamplerFilter *filter = engine->monitorFilter != NULL
+                                    ? &engine->monitorFilter->filter : NULL;
+    if (generation != engine->monitorProducerGeneration) {
+        if (filter != NULL) {
+            resamplerInit(&engine->monitorResampler, filter);
+        }
+        engine->monitorProducerGeneration = generation;
+    }
+    unsigned produced = 0, written = 0;
+    if (filter == NULL) {
+        produced = frames;
+        written = spscQueueWrite(&engine->monitorRing, pcm, frames);
+    } else {
+        unsigned consumed = 0;
+        while (consumed < frames) {
+            unsigned in = frames - consumed;
+            unsigned out = resamplerProcess(&engine->monitorResampler, pcm + consumed, &in,
+                                            engine->monitorScratch, MONITOR_SCRATCH_FRAMES);
+            consumed += in;
+            produced += out;
+            written += spscQueueWrite(&engine->monitorRing, engine->monitorScratch, out);
+            if (in == 0 && out == 0) {
+                break;
+            }
+        }
+    }
+    if (written < produced) {
+        atomic_fetch_add_explicit(&engine->monitorStats[MONITOR_STATS_DROPPED_FRAMES],
+                                  produced - written, memory_order_relaxed);
+    }
+    atomic_store_explicit(&engine->monitorChunkFrames, produced, memory_order_relaxed);
+    MonitorStamp stamp = {
+            atomic_load_explicit(&engine->monitorRing.tail, memory_order_relaxed), arrival
+    };
+    spscQueuePush(&engine->monitorStamps, &stamp);
+}
+
+void audioEngineMonitorChunk(AudioEngine *engine, const short *pcm, unsigned frames) {
+    //和 audioEngineStartMonitor 配对：它关掉监听后等这里返回才换系数表
+    atomic_fetch_add(&engine->captureActive, 1);
+    monitorCapture(engine, pcm, frames);
+    atomic_fetch_sub(&engine->captureActive, 1);
+}
+
+void audioEngineCaptureChunk(AudioEngine *engine, const short *pcm, unsigned frames) {
+    unsigned i;
+    //和 audioEngineRecordingStopped 配对：先登记再检查，停止之后到达的数据直接丢弃
+    atomic_fetch_add(&engine->captureActive, 1);
+    if (!atomic_load(&engine->recording)) {
+        atomic_fetch_sub(&engine->captureActive, 1);
+        return;
+    }
+    //块比环形区还大时只有最后 recorderCapacity 帧有意义
+    const short *src = pcm;
+    unsigned n = frames;
+    if (n > engine->recorderCapacity) {
+        src += n - engine->recorderCapacity;
+        n = engine->recorderCapacity;
+    }
+    unsigned first = engine->recorderCapacity - engine->recorderWrite;
+    if (first > n) {
+        first = n;
+    }
+    memcpy(engine->recorderBuffer + engine->recorderWrite, src, first * sizeof(short));
+    memcpy(engine->recorderBuffer, src + first, (n - first) * sizeof(short));
+    engine->recorderWrite = (engine->recorderWrite + n) % engine->recorderCapacity;
+    engine->recorderReceived += frames;
+
+    for (i = 0; i < engine->captureConsumerCount; ++i) {
+        engine->captureConsumers[i].chunk(engine->captureConsumers[i].context, pcm, frames);
+    }
+    atomic_fetch_sub(&engine->captureActive, 1);
+}
+
+static void reverseFrames(short *buf, unsigned begin, unsigned end) {
+    while (begin + 1 < end) {
+        short t = buf[begin];
+        buf[begin++] = buf[--end];
+        buf[end] = t;
+    }
+}
+
+void audioEngineRecordingStopped(AudioEngine *engine) {
+    if (!atomic_load(&engine->recording)) {
+        return;
+    }
+    atomic_store(&engine->recording, false);
+    //录音器已经停止，但最后一次回调可能还没返回
+    waitCaptureIdle(engine);
+    if (engine->recorderReceived >= engine->recorderCapacity) {
+        //环形区已经写满过一圈：原地旋转，让最早的样本回到开头
+        reverseFrames(engine->recorderBuffer, 0, engine->recorderWrite);
+        reverseFrames(engine->recorderBuffer, engine->recorderWrite, engine->recorderCapacity);
+        reverseFrames(engine->recorderBuffer, 0, engine->recorderCapacity);
+        engine->recorderFrames = engine->recorderCapacity;
+    } else {
+        engine->recorderFrames = (unsigned) engine->recorderReceived;
+    }
+}
+
+bool audioEngineStartMonitor(AudioEngine *engine, float gain, unsigned inputRate,
+                             unsigned outputDelayFrames) {
+    unsigned i;
+    if (engine->playerCommands.slots == NULL || inputRate == 0) {
+        return false;
+    }
+    if (engine->monitorRing.slots == NULL &&
+        !spscQueueInit(&engine->monitorRing, sizeof(short), MONITOR_RING_FRAMES)) {
+        return false;
+    }
+    if (engine->monitorStamps.slots == NULL &&
+        !spscQueueInit(&engine->monitorStamps, sizeof(MonitorStamp), MONITOR_STAMPS)) {
+        return false;
+    }
+    bool ok;
+    pthread_mutex_lock(&engine->controlLock);
+    ClipFilter *filter = getClipFilter(engine, inputRate, &ok);
+    if (filter != NULL) {
+        atomic_fetch_add_explicit(&filter->refs, 1, memory_order_relaxed);
+    }
+    pthread_mutex_unlock(&engine->controlLock);
+    if (!ok) {
+        return false;
+    }
+    //先关掉再修改，两个实时线程看到新的代号后才会使用新的设置
+    atomic_store(&engine->monitorEnabled, false);
+    waitCaptureIdle(engine);
+    if (engine->monitorFilter != NULL) {
+        atomic_fetch_sub_explicit(&engine->monitorFilter->refs, 1, memory_order_release);
+    }
+    engine->monitorFilter = filter;
+    atomic_store_explicit(&engine->monitorOutputDelay, outputDelayFrames, memory_order_relaxed);
+    for (i = 0; i < MONITOR_STATS_FIELDS; ++i) {
+        atomic_store_explicit(&engine->monitorStats[i], 0, memory_order_relaxed);
+    }
+    atomic_store_explicit(&engine->monitorStats[MONITOR_STATS_MIN_LATENCY_NS], INT64_MAX,
+                          memory_order_relaxed);
+    atomic_store_explicit(&engine->monitorLatencySum, 0, memory_order_relaxed);
+    audioEngineSetMonitorGain(engine, gain);
+    atomic_fetch_add_explicit(&engine->monitorGeneration, 1, memory_order_release);
+    atomic_store_explicit(&engine->monitorEnabled, true, memory_order_release);
+    return true;
+}
+
+void audioEngineStopMonitor(AudioEngine *engine) {
+    atomic_store(&engine->monitorEnabled, false);
+    //录音回调不再读 monitorFilter 之后才放掉它，系数表条目可以被替换
+    waitCaptureIdle(engine);
+    if (engine->monitorFilter != NULL) {
+        atomic_fetch_sub_explicit(&engine->monitorFilter->refs, 1, memory_order_release);
+        engine->monitorFilter = NULL;
+    }
+}
+
+void audioEngineSetMonitorGain(AudioEngine *engine, float gain) {
+    GainParams *params = &engine->groupParams[VOICE_GROUP_MONITOR];
+    setLevel(params, gain, params->muted);
+}
+
+void audioEngineMonitorStats(AudioEngine *engine, int64_t *out) {
+    unsigned i;
+    for (i = 0; i < MONITOR_STATS_FIELDS; ++i) {
+        out[i] = atomic_load_explicit(&engine->monitorStats[i], memory_order_relaxed);
+    }
+    if (out[MONITOR_STATS_MEASUREMENTS] == 0) {
+        out[MONITOR_STATS_MIN_LATENCY_NS] = 0;
+    } else {
+        out[MONITOR_STATS_MEAN_LATENCY_NS] =
+                atomic_load_explicit(&engine->monitorLatencySum, memory_order_relaxed) /
+                out[MONITOR_STATS_MEASUREMENTS];
+    }
+}
@@ -0,0 +1,243 @@
+#ifndef NATIVEAUDIO_AUDIO_ENGINE_H
+#define NATIVEAUDIO_AUDIO_ENGINE_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "audio_backend.h"
+#include "audio_decoder.h"
+#include "clip_registry.h"
+#include "reverb.h"
+
+//与平台无关的引擎核心：剪辑选择、重采样、混音、录音缓冲区和每个突发的填充逻辑。
+//OpenSL ES 和 JNI 只出现在 native-audio-jni.c / backend_opensl.c 中，
+//这里的代码也可以在普通 Linux 主机上编译，配合 null/WAV 后端做性能分析和回归测试。
+//
+//线程约定：audioEngineRender 只在音频回调线程中调用，定时事件函数可以在任意线程调用，
+//其余函数都在同一个控制线程中调用。
+//所有状态都在 AudioEngine 里，每个实例各自对应一个输出流，几个实例可以同时运行
+
+//剪辑编号（CLIP_NONE、内置剪辑和 CLIP_PLAYBACK）和 CLIP_SAMPLE_RATE 由 clip_registry.h 的剪辑表生成
+
+//录音的存储格式：单声道、16 位带符号小端序，采样率默认 16 kHz，可以用 audioEngineSetRecorderRate 修改。
+//录音长度不限，CLIP_PLAYBACK 播放最后 RECORDER_SECONDS 秒
+#define RECORDER_SAMPLE_RATE 16000
+#define RECORDER_MAX_SAMPLE_RATE 48000
+#define RECORDER_SECONDS 5
+
+//录音流的消费者，在录音回调线程中按块调用，不能阻塞
+typedef void (*CaptureCallback)(void *context, const short *pcm, unsigned frames);
+
+#define MAX_CAPTURE_CONSUMERS 4
+
+//声部组：每组有自己的音量和声像，最后再乘以主音量和主声像
+//内置剪辑和录音回放
+#define VOICE_GROUP_CLIPS 0
+//audioEnginePlayPcm 播放的调用方 PCM，例如映射进来的资源文件
+#define VOICE_GROUP_PCM 1
+//监听输入
+#define VOICE_GROUP_MONITOR 2
+//立体声资源的左右声道各用一个声部，分别属于这两个组，只送到输出的一侧。
+//它们没有自己的参数，音量、静音、声像和定时音量都跟随 VOICE_GROUP_PCM
+#define VOICE_GROUP_PCM_LEFT 3
+#define VOICE_GROUP_PCM_RIGHT 4
+#define VOICE_GROUPS 5
+
+//解码资源最多保留的声道数，更多声道的源混成单声道
+#define ASSET_MAX_CHANNELS 2
+
+//音量和声像变化的默认过渡时间
+#define DEFAULT_RAMP_MS 20
+
+typedef struct AudioEngine AudioEngine;
+
+//创建一个引擎实例，还没有准备输出，先调用 audioEngineInit。内存不足时返回 NULL
+AudioEngine *audioEngineCreate(void);
+
+//关闭并释放引擎，调用前后端要已经停止回调
+void audioEngineDestroy(AudioEngine *engine);
+
+//按输出采样率和最大突发帧数准备混音器、命令队列和剪辑缓存。
+//可以重复调用，输出采样率变化时缓存中的剪辑会失效，突发帧数变化时停止所有声部。
+//调用时后端回调不能在运行：重复调用前先停止并销毁旧的后端，之后再创建新的
+bool audioEngineInit(AudioEngine *engine, unsigned sampleRate, unsigned maxBurstFrames);
+
+//后端已经停止回调后调用，释放所有资源
+void audioEngineShutdown(AudioEngine *engine);
+
+//音频回调线程：处理控制线程的命令，把所有声部在 float 总线上混合成一个单声道或立体声突发，
+//再按 format 输出：float 原样交出，int16 加 TPDF 抖动后饱和转换。
+//签名与 AudioRenderCallback 相同，context 是 AudioEngine
+void audioEngineRender(void *context, void *dst, unsigned frames, unsigned channels,
+                       AudioSampleFormat format);
+
+//用一个新声部播放剪辑 count 次，CLIP_NONE 停止所有声部。不会阻塞
+bool audioEngineSelectClip(AudioEngine *engine, int which, int count);
+
+//剪辑里的循环区间，单位是剪辑自己采样率下的帧。先播放 start 之前的部分，[start, end) 重复
+//count 次（count 为负时一直重复，直到停止），最后播完 end 之后的部分。所有接缝都在声部里渲染，
+//不经过缓冲区队列；crossfade 不为 0 时每次回到 start 前用这么多帧等功率交叉淡化，
+//不是整周期的循环（例如锯齿波在 44.1 kHz 下）也没有咔嗒声
+typedef struct {
+    unsigned start;
+    unsigned end;
+    unsigned crossfade;
+} ClipLoop;
+
+//loop 为 NULL 时与 audioEngineSelectClip 相同
+bool audioEngineSelectClipLoop(AudioEngine *engine, int which, int count,
+                               const ClipLoop *loop);
+
+//用一个新声部（属于 VOICE_GROUP_PCM）播放调用方持有的 16 位单声道 PCM（例如映射进内存的 WAV）
+//count 次，不拷贝，采样率与输出不同时逐突发重采样。refs 不为 NULL 时每个声部持有一个引用，
+//调用方要等它归零（或者后端已经停止）才能释放 pcm。不会阻塞
+bool audioEnginePlayPcm(AudioEngine *engine, const short *pcm, unsigned frames,
+                        unsigned sampleRate, int count, atomic_int *refs);
+
+//停止所有引用 refs 的声部，引用在下一个突发开始时交还
+bool audioEngineStopPcm(AudioEngine *engine, atomic_int *refs);
+
+//解码后的资源：decoder 把资源解码一次放进按 key 索引、受内存预算限制的缓存，之后每次播放都是一个
+//VOICE_GROUP_PCM 的声部，像剪辑一样混音、计量和处理，不用再解码。decoder 总是归引擎所有。
+//立体声的资源保留两个声道，播放时左右声道各是一个声部，见 VOICE_GROUP_PCM_LEFT/RIGHT。
+//progressive 为 true 时先同步解码第一块，剩下的由后台线程解码，马上就可以播放；声部追上解码时输出静音。
+//不渐进时整个资源在 controlLock 下解码完，期间其它控制调用会等待，只适合在加载阶段使用。
+//key 已经在缓存里时直接返回 true；解码失败或者超出预算时返回 false
+bool audioEngineLoadAsset(AudioEngine *engine, const char *key, AudioDecoder *decoder,
+                          bool progressive);
+
+//key 是否还在缓存里（可能被淘汰了，这时要重新 audioEngineLoadAsset）
+bool audioEngineHasAsset(AudioEngine *engine, const char *key);
+
+//缓存里 key 的声道数（1 或 2），不在缓存里时返回 0
+unsigned audioEngineAssetChannels(AudioEngine *engine, const char *key);
+
+//用一个新声部播放已解码的资源 count 次，不在缓存里时返回 false。不会阻塞
+bool audioEnginePlayAsset(AudioEngine *engine, const char *key, int count);
+
+//停止所有播放这个资源的声部
+bool audioEngineStopAsset(AudioEngine *engine, const char *key);
+
+//修改解码资源缓存的预算（默认 32 MB），立即淘汰没有声部在用的最久未用资源
+void audioEngineSetAssetCacheBudget(AudioEngine *engine, size_t budgetBytes);
+
+//定时事件：上面的命令在下一个突发开始时执行，精度是一个突发；定时版本在输出时钟的第 frame 帧执行，
+//音频回调在那一帧切开突发，声部精确地从那个样本开始。frame 已经过去时在下一个突发开头执行。
+//定时函数可以在任意线程调用，不会阻塞音频回调；最多 64 个事件在等待执行，队列满时返回 false
+
+//输出时钟：已经渲染的帧数，不含设备队列里还没播出的部分。任意线程读取
+uint64_t audioEngineFrameTime(AudioEngine *engine);
+
+//loop 可以为 NULL，见 audioEngineSelectClipLoop
+bool audioEngineScheduleClip(AudioEngine *engine, uint64_t frame, int which, int count,
+                             const ClipLoop *loop);
+
+bool audioEngineSchedulePcm(AudioEngine *engine, uint64_t frame, const short *pcm,
+                            unsigned frames, unsigned sampleRate, int count, atomic_int *refs);
+
+bool audioEngineScheduleAsset(AudioEngine *engine, uint64_t frame, const char *key, int count);
+
+//停止所有声部
+bool audioEngineScheduleStop(AudioEngine *engine, uint64_t frame);
+
+//把组增益再乘上 millibel 对应的增益（之前的定时音量被替换），从第 frame 帧开始按过渡时间变化
+bool audioEngineScheduleGroupVolume(AudioEngine *engine, uint64_t frame, int group,
+                                    int millibel);
+
+//音量、静音和声像只是写进一个原子参数块，不发命令也不会阻塞；音频回调在下一个突发开始时读到，
+//在过渡时间内逐样本线性变化到新值，拖动滑块时没有拉链噪声。
+//声像是 -1000（左）到 1000（右）的千分比，一侧增益保持不变，另一侧按比例减小；单声道输出时忽略
+void audioEngineSetVolume(AudioEngine *engine, int millibel);
+
+void audioEngineSetMute(AudioEngine *engine, bool mute);
+
+void audioEngineSetPan(AudioEngine *engine, int permille);
+
+void audioEngineSetGroupVolume(AudioEngine *engine, int group, int millibel);
+
+void audioEngineSetGroupMute(AudioEngine *engine, int group, bool mute);
+
+void audioEngineSetGroupPan(AudioEngine *engine, int group, int permille);
+
+//VOICE_GROUP_PCM 里资源的声道静音和独奏，规则与 SLMuteSoloItf 相同：静音的声道不可听，
+//有声道独奏时其它声道也不可听。立体声资源的声道 0/1 是左右声道，单声道的声部只有声道 0。
+//和音量一样在过渡时间内平滑变化
+void audioEngineSetChannelMute(AudioEngine *engine, unsigned channel, bool mute);
+
+void audioEngineSetChannelSolo(AudioEngine *engine, unsigned channel, bool solo);
+
+void audioEngineSetRampTime(AudioEngine *engine, unsigned milliseconds);
+
+//int16 输出是否加抖动，默认打开。关掉后单个未经处理的 int16 声部可以逐位原样输出
+void audioEngineSetDither(AudioEngine *engine, bool enabled);
+
+//混音总线上的混响，不需要 SL_IID_EFFECTSEND，快速音频路径上也能用。默认关闭，参数是 STONECORRIDOR；
+//关掉后尾音继续衰减，不会突然截断。修改在下一个突发开始时生效
+void audioEngineEnableReverb(AudioEngine *engine, bool enabled);
+
+//preset 是 ReverbPreset 中的一个，超出范围时返回 false
+bool audioEngineSetReverbPreset(AudioEngine *engine, int preset);
+
+void audioEngineSetReverbSettings(AudioEngine *engine, const ReverbSettings *settings);
+
+void audioEngineSetResamplerQuality(AudioEngine *engine, int quality);
+
+void audioEngineSetClipCacheBudget(AudioEngine *engine, size_t budgetBytes);
+
+//录音进行中时不能增删消费者，返回 false
+bool audioEngineAddCaptureConsumer(AudioEngine *engine, CaptureCallback chunk, void *context);
+
+bool audioEngineRemoveCaptureConsumer(AudioEngine *engine, CaptureCallback chunk, void *context);
+
+//设置存储采样率，之后的录音、CLIP_PLAYBACK 和监听都按它解释录音数据。
+//录音或监听进行中、采样率超出范围时返回 false
+bool audioEngineSetRecorderRate(AudioEngine *engine, unsigned sampleRate);
+
+unsigned audioEngineRecorderRate(AudioEngine *engine);
+
+//录音开始前调用：旧录音作废，CLIP_PLAYBACK 在录音结束前不可播放
+void audioEngineRecordingStarted(AudioEngine *engine);
+
+//录音回调线程：又录到了 frames 帧，依次交给所有消费者
+void audioEngineCaptureChunk(AudioEngine *engine, const short *pcm, unsigned frames);
+
+//录音器停止后调用，等最后一次回调返回，再把最近 5 秒整理成 CLIP_PLAYBACK
+void audioEngineRecordingStopped(AudioEngine *engine);
+
+//监听统计的字段下标，JNI 的 getMonitorStats 按这个顺序返回
+typedef enum {
+    //最近一个突发第一个样本从被录下到被播放的时间，不含 ADC/DAC 自身的硬件延迟
+    MONITOR_STATS_LATENCY_NS = 0,
+    MONITOR_STATS_MIN_LATENCY_NS,
+    MONITOR_STATS_MAX_LATENCY_NS,
+    MONITOR_STATS_MEAN_LATENCY_NS,
+    MONITOR_STATS_MEASUREMENTS,
+    //音频回调取数据时输入还没到
+    MONITOR_STATS_UNDERRUNS,
+    //环形区满了或积压过多而丢弃的帧数
+    MONITOR_STATS_DROPPED_FRAMES,
+    //最近一次音频回调时环形区里的帧数
+    MONITOR_STATS_BUFFERED_FRAMES,
+    MONITOR_STATS_FIELDS,
+} MonitorStatsField;
+
+//打开监听：录音流（需要另外开始录音）经过一个无锁环形区直接混进输出，预缓冲只有一块输入加一个突发。
+//inputRate 是 audioEngineMonitorChunk 收到的数据的采样率，通常是设备本机采样率，不经过存储采样率。
+//outputDelayFrames 是一个突发渲染完到开始播放之间设备队列里已有的帧数，只用于计算延迟
+bool audioEngineStartMonitor(AudioEngine *engine, float gain, unsigned inputRate,
+                             unsigned outputDelayFrames);
+
+//录音回调线程：抽取之前的 frames 帧输入，监听关闭时直接返回
+void audioEngineMonitorChunk(AudioEngine *engine, const short *pcm, unsigned frames);
+
+void audioEngineStopMonitor(AudioEngine *engine);
+
+//与 VOICE_GROUP_MONITOR 的音量是同一个值，只是用线性增益表示
+void audioEngineSetMonitorGain(AudioEngine *engine, float gain);
+
+//任意线程：读取监听统计，out 至少 MONITOR_STATS_FIELDS 个元素
+void audioEngineMonitorStats(AudioEngine *engine, int64_t *out);
+
+#endif //NATIVEAUDIO_AUDIO_ENGINE_H
@@ -0,0 +1,62 @@
+#include <stdlib.h>
+
+#include "audio_backend.h"
+
+typedef struct {
+    AudioBackend base;
+    void *burst;
+} NullBackend;
+
+static bool nullStart(AudioBackend *backend) {
+    (void) backend;
+    return true;
+}
+
+static void nullStop(AudioBackend *backend) {
+    (void) backend;
+}
+
+static unsigned nullPump(AudioBackend *backend, unsigned frames) {
+    NullBackend *null = (NullBackend *) backend;
+    unsigned done = 0;
+    //和设备一样每次只要一个完整的突发，最后不足一个突发的部分留到下一次
+    while (frames - done >= backend->burstFrames) {
+        audioBackendRenderBurst(backend, null->burst, backend->burstFrames);
+        done += backend->burstFrames;
+    }
+    return done;
+}
+
+static void nullDestroy(AudioBackend *backend) {
+    NullBackend *null = (NullBackend *) backend;
+    free(null->burst);
+    free(null);
+}
+
+static const AudioBackendOps nullOps = {
+        "null", nullStart, nullStop, nullPump, nullDestroy,
+};
+
+AudioBackend *audioBackendCreateNull(unsigned sampleRate, unsigned burstFrames,
+                                     unsigned channels, AudioSampleFormat format,
+                                     AudioRenderCallback render, void *context) {
+    NullBackend *null = (NullBackend *) calloc(1, sizeof(NullBackend));
+    if (null == NULL || burstFrames == 0 || channels < 1 || channels > 2) {
+        free(null);
+        return NULL;
+    }
+    null->burst = malloc(burstFrames * channels * audioSampleBytes(format));
+    if (null->burst == NULL) {
+        free(null);
+        return NULL;
+    }
+    null->base.ops = &nullOps;
+    null->base.sampleRate = sampleRate;
+    null->base.burstFrames = burstFrames;
+    null->base.channels = channels;
+    null->base.format = format;
+    null->base.bufferedBursts = 1;
+    null->base.render = render;
+    null->base.context = context;
+    return &null->base;
+}
@@ -0,0 +1,213 @@
+#include "backend_opensl.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+#define UNUSED(x) (void)(x);
+
+#define BQ_PLAYER_BUFFERS 2
+
+typedef struct {
+    AudioBackend base;
+    SLObjectItf playerObject;
+    SLPlayItf play;
+    SLAndroidSimpleBufferQueueItf bufferQueue;
+    unsigned char *buffers;
+    unsigned bufIndex;
+    unsigned buffersQueued;
+} OpenSLBackend;
+
+//渲染下一个突发并放入缓冲区队列，没有声部时送出静音以保持流不断
+static bool enqueueNextBurst(OpenSLBackend *sl) {
+    unsigned frames = sl->base.burstFrames;
+    unsigned bytes = frames * audioBackendFrameBytes(&sl->base);
+    unsigned char *buf = sl->buffers + sl->bufIndex * bytes;
+    audioBackendRenderBurst(&sl->base, buf, frames);
+    SLresult result;
+    result = (*sl->bufferQueue)->Enqueue(sl->bufferQueue, buf, bytes);
+    if (result != SL_RESULT_SUCCESS) {
+        return false;
+    }
+    sl->bufIndex = (sl->bufIndex + 1) % BQ_PLAYER_BUFFERS;
+    ++sl->buffersQueued;
+    return true;
+}
+
+static void bqPlayerCallback(SLAndroidSimpleBufferQueueItf bq, void *context) {
+    OpenSLBackend *sl = (OpenSLBackend *) context;
+    assert(bq == sl->bufferQueue);
+    CallbackStats *stats = sl->base.stats;
+    uint64_t arrival = stats != NULL ? callbackStatsNow() : 0;
+    //刚播放完的缓冲区现在空闲，用下一个突发填充它
+    --sl->buffersQueued;
+    unsigned queueDepth = sl->buffersQueued;
+    if (stats != NULL) {
+        //以播放器报告的为准，它知道设备实际还剩多少
+        SLAndroidSimpleBufferQueueState state;
+        if ((*bq)->GetState(bq, &state) == SL_RESULT_SUCCESS) {
+            queueDepth = state.count;
+        }
+    }
+    bool queued = enqueueNextBurst(sl);
+    if (stats != NULL) {
+        //入队失败时设备下一次同样会断流，也算一次欠载
+        callbackStatsRecord(stats, arrival, callbackStatsNow(), queued ? queueDepth : 0);
+    }
+}
+
+static bool openslStart(AudioBackend *backend) {
+    OpenSLBackend *sl = (OpenSLBackend *) backend;
+    SLresult result;
+    //流从这里开始就一直运行：先把所有突发缓冲区（此时是静音）排队，
+    //之后由 bqPlayerCallback 逐个重新填充
+    sl->bufIndex = 0;
+    sl->buffersQueued = 0;
+    unsigned i;
+    for (i = 0; i < BQ_PLAYER_BUFFERS; ++i) {
+        if (!enqueueNextBurst(sl)) {
+            return false;
+        }
+    }
+    // 将玩家的状态设置为正在播放
+    result = (*sl->play)->SetPlayState(sl->play, SL_PLAYSTATE_PLAYING);
+    return SL_RESULT_SUCCESS == result;
+}
+
+static void openslStop(AudioBackend *backend) {
+    OpenSLBackend *sl = (OpenSLBackend *) backend;
+    SLresult result;
+    result = (*sl->play)->SetPlayState(sl->play, SL_PLAYSTATE_STOPPED);
+    UNUSED(result)
+    result = (*sl->bufferQueue)->Clear(sl->bufferQueue);
+    UNUSED(result)
+    sl->buffersQueued = 0;
+}
+
+static void openslDestroy(AudioBackend *backend) {
+    OpenSLBackend *sl = (OpenSLBackend *) backend;
+    // destroy buffer queue audio player object, and invalidate all associated
+    // interfaces
+    if (sl->playerObject != NULL) {
+        (*sl->playerObject)->Destroy(sl->playerObject);
+    }
+    free(sl->buffers);
+    free(sl);
+}
+
+static const AudioBackendOps openslOps = {
+        "opensl", openslStart, openslStop, NULL, openslDestroy,
+};
+
+AudioBackend *audioBackendCreateOpenSL(SLEngineItf engine, SLObjectItf outputMix,
+                                       SLmilliHertz sampleRate, unsigned burstFrames,
+                                       AudioSampleFormat format, AudioRenderCallback render,
+                                       void *context) {
+    SLresult result;
+    OpenSLBackend *sl = (OpenSLBackend *) calloc(1, sizeof(OpenSLBackend));
+    if (sl == NULL) {
+        return NULL;
+    }
+    sl->base.ops = &openslOps;
+    sl->base.sampleRate = sampleRate ? sampleRate / 1000 : SL_SAMPLINGRATE_8 / 1000;
+    sl->base.burstFrames = burstFrames;
+    //引擎按立体声输出，声像在引擎里完成，快速路径同样支持双声道
+    sl->base.channels = 2;
+    sl->base.bufferedBursts = BQ_PLAYER_BUFFERS;
+    sl->base.render = render;
+    sl->base.context = context;
+    //按较大的 float 分配，退回 int16 时也够用
+    sl->buffers = (unsigned char *) calloc(BQ_PLAYER_BUFFERS * burstFrames * sl->base.channels,
+                                           sizeof(float));
+    if (sl->buffers == NULL) {
+        openslDestroy(&sl->base);
+        return NULL;
+    }
+
+    //配置音频源
+    SLDataLocator_AndroidSimpleBufferQueue loc_bufq = {
+            SL_DATALOCATOR_ANDROIDSIMPLEBUFFERQUEUE, BQ_PLAYER_BUFFERS
+    };
+
+    SLDataFormat_PCM format_pcm = {
+            SL_DATAFORMAT_PCM, 2,
+            SL_SAMPLINGRATE_8, SL_PCMSAMPLEFORMAT_FIXED_16,
+            SL_PCMSAMPLEFORMAT_FIXED_16, SL_SPEAKER_FRONT_LEFT | SL_SPEAKER_FRONT_RIGHT,
+            SL_BYTEORDER_LITTLEENDIAN
+    };
+
+    //尽可能启用快速音频：一旦我们将相同的速率设置为本机，将触发快速音频路径
+    if (sampleRate) {
+        format_pcm.samplesPerSec = sampleRate;
+    }
+    SLAndroidDataFormat_PCM_EX format_pcm_ex = {
+            SL_ANDROID_DATAFORMAT_PCM_EX, 2,
+            format_pcm.samplesPerSec, SL_PCMSAMPLEFORMAT_FIXED_32,
+            SL_PCMSAMPLEFORMAT_FIXED_32, SL_SPEAKER_FRONT_LEFT | SL_SPEAKER_FRONT_RIGHT,
+            SL_BYTEORDER_LITTLEENDIAN, SL_ANDROID_PCM_REPRESENTATION_FLOAT
+    };
+    SLDataSource audioSrc = {
+            &loc_bufq, &format_pcm
+    };
+    //配置音频接收器
+    SLDataLocator_OutputMix loc_outmix = {
+            SL_DATALOCATOR_OUTPUTMIX, outputMix
+    };
+    SLDataSink audioSnk = {
+            &loc_outmix, NULL
+    };
+
+    //创建音频播放器：快速音频在需要SL_IID_EFFECTSEND时不支持，混响由引擎在混音总线上完成
+    const SLInterfaceID ids[2] = {
+            SL_IID_BUFFERQUEUE, SL_IID_VOLUME,
+    };
+    const SLboolean req[2] = {SL_BOOLEAN_TRUE, SL_BOOLEAN_TRUE,};
+
+    //float 直接交给系统混音器，省掉一次量化；不支持 PCM_EX 的设备上创建失败，改用 int16
+    result = SL_RESULT_CONTENT_UNSUPPORTED;
+    if (format == AUDIO_FORMAT_FLOAT) {
+        audioSrc.pFormat = &format_pcm_ex;
+        result = (*engine)->CreateAudioPlayer(engine, &sl->playerObject, &audioSrc, &audioSnk,
+                                              2, ids, req);
+    }
+    if (SL_RESULT_SUCCESS == result) {
+        sl->base.format = AUDIO_FORMAT_FLOAT;
+    } else {
+        audioSrc.pFormat = &format_pcm;
+        sl->base.format = AUDIO_FORMAT_S16;
+        result = (*engine)->CreateAudioPlayer(engine, &sl->playerObject, &audioSrc, &audioSnk,
+                                              2, ids, req);
+    }
+    if (SL_RESULT_SUCCESS != result) {
+        sl->playerObject = NULL;
+        openslDestroy(&sl->base);
+        return NULL;
+    }
+
+    result = (*sl->playerObject)->Realize(sl->playerObject, SL_BOOLEAN_FALSE);
+    if (SL_RESULT_SUCCESS != result) {
+        openslDestroy(&sl->base);
+        return NULL;
+    }
+
+    result = (*sl->playerObject)->GetInterface(sl->playerObject, SL_IID_PLAY, &sl->play);
+    assert(SL_RESULT_SUCCESS == result);
+    UNUSED(result)
+
+    result = (*sl->playerObject)->GetInterface(sl->playerObject, SL_IID_BUFFERQUEUE,
+                                               &sl->bufferQueue);
+    assert(SL_RESULT_SUCCESS == result);
+    UNUSED(result)
+
+    result = (*sl->bufferQueue)->RegisterCallback(sl->bufferQueue, bqPlayerCallback, sl);
+    assert(SL_RESULT_SUCCESS == result);
+    UNUSED(result)
+
+#if 0  \
+    // 已知为单声道的源不支持mutesolo，因为这是获取mutesolo接口
+    result = (*sl->playerObject)->GetInterface(sl->playerObject, SL_IID_MUTESOLO, &bqPlayerMuteSolo);
+    assert(SL_RESULT_SUCCESS == result);
+    (void)result;
+#endif
+
+    return &sl->base;
+}
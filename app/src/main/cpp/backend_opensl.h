@@ -0,0 +1,20 @@
+#ifndef NATIVEAUDIO_BACKEND_OPENSL_H
+#define NATIVEAUDIO_BACKEND_OPENSL_H
+
+#include <SLES/OpenSLES.h>
+#include <SLES/OpenSLES_Android.h>
+
+#include "audio_backend.h"
+
+//OpenSL ES 缓冲区队列播放器后端：BQ_PLAYER_BUFFERS 个恰好为设备突发(burst)大小的小缓冲区
+//在缓冲区队列中轮转，每次回调时调用 render 填充刚播放完的那个缓冲区。
+//sampleRate 为 0 表示没有拿到设备本机采样率，此时以 8 kHz 创建。混响在引擎里做，不请求 SL_IID_EFFECTSEND，
+//两种情况下播放器都有资格走快速音频路径。
+//format 为 AUDIO_FORMAT_FLOAT 时先尝试用 PCM_EX 直接送出 float，设备不支持时退回 int16，
+//实际使用的格式见返回的 backend->format
+AudioBackend *audioBackendCreateOpenSL(SLEngineItf engine, SLObjectItf outputMix,
+                                       SLmilliHertz sampleRate, unsigned burstFrames,
+                                       AudioSampleFormat format, AudioRenderCallback render,
+                                       void *context);
+
+#endif //NATIVEAUDIO_BACKEND_OPENSL_H
@@ -0,0 +1,86 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "audio_backend.h"
+#include "wav_format.h"
+
+typedef struct {
+    AudioBackend base;
+    FILE *file;
+    void *burst;
+    uint32_t dataBytes;
+    bool failed;
+} WavBackend;
+
+static bool wavStart(AudioBackend *backend) {
+    WavBackend *wav = (WavBackend *) backend;
+    return !wav->failed;
+}
+
+static void wavStop(AudioBackend *backend) {
+    WavBackend *wav = (WavBackend *) backend;
+    //停止后文件就是完整的，之后再启动会继续往后写
+    if (!wavFinalize(wav->file, wav->dataBytes)) {
+        wav->failed = true;
+    }
+    fflush(wav->file);
+}
+
+static unsigned wavPump(AudioBackend *backend, unsigned frames) {
+    WavBackend *wav = (WavBackend *) backend;
+    unsigned done = 0;
+    while (!wav->failed && frames - done >= backend->burstFrames) {
+        audioBackendRenderBurst(backend, wav->burst, backend->burstFrames);
+        //WAV 是小端序，样本按主机字节序直接写出，所以只支持小端主机（ARM/x86 都是）
+        unsigned frameBytes = audioBackendFrameBytes(backend);
+        if (fwrite(wav->burst, frameBytes, backend->burstFrames, wav->file) !=
+            backend->burstFrames) {
+            wav->failed = true;
+            break;
+        }
+        wav->dataBytes += backend->burstFrames * frameBytes;
+        done += backend->burstFrames;
+    }
+    return done;
+}
+
+static void wavDestroy(AudioBackend *backend) {
+    WavBackend *wav = (WavBackend *) backend;
+    fclose(wav->file);
+    free(wav->burst);
+    free(wav);
+}
+
+static const AudioBackendOps wavOps = {
+        "wav", wavStart, wavStop, wavPump, wavDestroy,
+};
+
+AudioBackend *audioBackendCreateWav(const char *path, unsigned sampleRate, unsigned burstFrames,
+                                    unsigned channels, AudioSampleFormat format,
+                                    AudioRenderCallback render, void *context) {
+    WavBackend *wav = (WavBackend *) calloc(1, sizeof(WavBackend));
+    if (wav == NULL || burstFrames == 0 || channels < 1 || channels > 2) {
+        free(wav);
+        return NULL;
+    }
+    wav->burst = malloc(burstFrames * channels * audioSampleBytes(format));
+    wav->file = fopen(path, "wb");
+    if (wav->burst == NULL || wav->file == NULL ||
+        !wavWriteHeader(wav->file, sampleRate, channels, 8 * audioSampleBytes(format), 0)) {
+        if (wav->file != NULL) {
+            fclose(wav->file);
+        }
+        free(wav->burst);
+        free(wav);
+        return NULL;
+    }
+    wav->base.ops = &wavOps;
+    wav->base.sampleRate = sampleRate;
+    wav->base.burstFrames = burstFrames;
+    wav->base.channels = channels;
+    wav->base.format = format;
+    wav->base.bufferedBursts = 1;
+    wav->base.render = render;
+    wav->base.context = context;
+    return &wav->base;
+}
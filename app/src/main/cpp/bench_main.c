@@ -0,0 +1,642 @@
+//主机上的微基准：剪辑重采样、录音抽取、N 个声部混音、短循环区间、mmap 的 WAV 播放、资源解码、输出级、混响
+//和完整的回调填充。
+//
+//    native-audio-bench [-r 输出采样率] [-m 每批毫秒数] [名称过滤]
+//
+//每个用例一行 JSON，便于脚本收集和比较：
+//    {"bench":"fill","rate":48000,"burst":256,"voices":4,"ns_per_frame":...,"deadline":...}
+//ns_per_frame 是每个输出帧的耗时；deadline 是处理一个突发（或一段剪辑）所用时间占其实时时长的比例，
+//1.0 表示刚好赶上设备的截止时间。每个用例跑 BENCH_BATCHES 批，取中位数
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "audio_backend.h"
+#include "audio_decoder.h"
+#include "audio_engine.h"
+#include "capture_decimator.h"
+#include "dsp_kernels.h"
+#include "mapped_wav.h"
+#include "mixer.h"
+#include "resampler.h"
+#include "reverb.h"
+#include "wav_format.h"
+
+#define BENCH_BATCHES 7
+
+static const char *qualityNames[] = {"low", "medium", "high"};
+
+static double minBatchNs = 20e6;
+static const char *filter = NULL;
+
+static double nowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static int compareDouble(const void *a, const void *b) {
+    double x = *(const double *) a, y = *(const double *) b;
+    return x < y ? -1 : x > y;
+}
+
+//反复调用 run，直到一批至少 minBatchNs，返回每次调用耗时的中位数（纳秒）
+static double measure(void (*run)(void *), void *context) {
+    double batches[BENCH_BATCHES];
+    unsigned iterations = 1;
+    int b;
+    //预热，同时估计一批需要多少次
+    for (;;) {
+        double start = nowNs();
+        unsigned i;
+        for (i = 0; i < iterations; ++i) {
+            run(context);
+        }
+        double elapsed = nowNs() - start;
+        if (elapsed >= minBatchNs / 4) {
+            iterations = (unsigned) (iterations * minBatchNs / elapsed) + 1;
+            break;
+        }
+        iterations *= 2;
+    }
+    for (b = 0; b < BENCH_BATCHES; ++b) {
+        double start = nowNs();
+        unsigned i;
+        for (i = 0; i < iterations; ++i) {
+            run(context);
+        }
+        batches[b] = (nowNs() - start) / iterations;
+    }
+    qsort(batches, BENCH_BATCHES, sizeof(double), compareDouble);
+    return batches[BENCH_BATCHES / 2];
+}
+
+static bool selected(const char *name) {
+    return filter == NULL || strstr(name, filter) != NULL;
+}
+
+//frames 是每次调用产生的输出帧数，realtimeNs 是这些帧在设备上的播放时长
+static void report(const char *bench, const char *extra, double nsPerCall, unsigned frames,
+                   double realtimeNs) {
+    printf("{\"bench\":\"%s\",%s,\"isa\":\"%s\",\"ns_per_frame\":%.3f,\"deadline\":%.5f}\n",
+           bench, extra, dsp->name, nsPerCall / frames, nsPerCall / realtimeNs);
+    fflush(stdout);
+}
+
+//可重复的伪随机测试信号，避免全零输入走捷径
+static void fillNoise(short *buf, unsigned frames) {
+    unsigned seed = 12345;
+    unsigned i;
+    for (i = 0; i < frames; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        buf[i] = (short) (seed >> 16) / 4;
+    }
+}
+
+typedef struct {
+    const ResamplerFilter *filter;
+    const short *in;
+    unsigned inFrames;
+    short *out;
+} ConvertCase;
+
+static void runConvert(void *context) {
+    ConvertCase *c = (ConvertCase *) context;
+    resamplerConvert(c->filter, c->in, c->inFrames, c->out);
+}
+
+//剪辑第一次播放时整段转换到输出采样率（剪辑缓存未命中的代价）
+static void benchResampleClip(unsigned outRate) {
+    static const unsigned inRates[] = {8000, 16000};
+    unsigned r, q;
+    if (!selected("resample_clip")) {
+        return;
+    }
+    for (r = 0; r < sizeof(inRates) / sizeof(inRates[0]); ++r) {
+        unsigned inRate = inRates[r];
+        if (inRate == outRate) {
+            continue;
+        }
+        //一秒的源剪辑
+        short *in = (short *) malloc(inRate * sizeof(short));
+        fillNoise(in, inRate);
+        for (q = RESAMPLER_QUALITY_LOW; q <= RESAMPLER_QUALITY_HIGH; ++q) {
+            ResamplerFilter f;
+            if (!resamplerFilterInit(&f, inRate, outRate, (ResamplerQuality) q)) {
+                continue;
+            }
+            unsigned outFrames = resamplerOutputFrames(&f, inRate);
+            ConvertCase c = {&f, in, inRate, (short *) malloc(outFrames * sizeof(short))};
+            double ns = measure(runConvert, &c);
+            char extra[128];
+            snprintf(extra, sizeof(extra),
+                     "\"in_rate\":%u,\"rate\":%u,\"quality\":\"%s\",\"taps\":%u",
+                     inRate, outRate, qualityNames[q], f.taps);
+            report("resample_clip", extra, ns, outFrames, 1e9 * outFrames / outRate);
+            free(c.out);
+            resamplerFilterRelease(&f);
+        }
+        free(in);
+    }
+}
+
+typedef struct {
+    CaptureDecimator decimator;
+    const short *in;
+    unsigned inFrames;
+    unsigned position;
+    unsigned burst;
+    short *out;
+} DecimateCase;
+
+//每次调用消费一个输入突发，源数据读完后回到开头
+static void runDecimate(void *context) {
+    DecimateCase *c = (DecimateCase *) context;
+    if (c->position + c->burst > c->inFrames) {
+        c->position = 0;
+    }
+    captureDecimatorProcess(&c->decimator, c->in + c->position, c->burst, c->out);
+    c->position += c->burst;
+}
+
+//录音前端：设备本机采样率的输入突发经过半带级和重采样器抽取到 16 kHz
+static void benchDecimate(unsigned deviceRate) {
+    static const unsigned bursts[] = {64, 256, 1024};
+    unsigned b, q;
+    if (!selected("decimate") || deviceRate <= RECORDER_SAMPLE_RATE) {
+        return;
+    }
+    short *in = (short *) malloc(deviceRate * sizeof(short));
+    short *out = (short *) malloc(1024 * sizeof(short));
+    fillNoise(in, deviceRate);
+    for (q = RESAMPLER_QUALITY_LOW; q <= RESAMPLER_QUALITY_HIGH; ++q) {
+        for (b = 0; b < sizeof(bursts) / sizeof(bursts[0]); ++b) {
+            DecimateCase c = {.in = in, .inFrames = deviceRate, .burst = bursts[b], .out = out};
+            if (!captureDecimatorInit(&c.decimator, deviceRate, RECORDER_SAMPLE_RATE,
+                                      CAPTURE_FORMAT_S16, (ResamplerQuality) q, bursts[b])) {
+                continue;
+            }
+            double ns = measure(runDecimate, &c);
+            char extra[160];
+            snprintf(extra, sizeof(extra),
+                     "\"in_rate\":%u,\"rate\":%u,\"burst\":%u,\"quality\":\"%s\","
+                     "\"halfband_stages\":%u,\"taps\":%u",
+                     deviceRate, RECORDER_SAMPLE_RATE, bursts[b], qualityNames[q],
+                     c.decimator.stageCount,
+                     c.decimator.resample ? c.decimator.filter.taps : 0);
+            //按输入帧计，截止时间是一个输入突发的时长
+            report("decimate", extra, ns, bursts[b], 1e9 * bursts[b] / deviceRate);
+            captureDecimatorRelease(&c.decimator);
+        }
+    }
+    free(out);
+    free(in);
+}
+
+typedef struct {
+    Mixer mixer;
+    float *out;
+    unsigned burst;
+} MixCase;
+
+static void runMix(void *context) {
+    MixCase *c = (MixCase *) context;
+    //引擎每个突发先清空总线
+    memset(c->out, 0, c->burst * 2 * sizeof(float));
+    mixerRender(&c->mixer, c->out, c->burst, 2);
+}
+
+//N 个一直循环的声部，源已经是输出采样率（缓存命中）或者需要逐突发重采样（缓存放不下）。
+//和设备上一样混合成立体声
+static void benchMix(unsigned outRate) {
+    static const unsigned voiceCounts[] = {1, 2, 4, 8};
+    const unsigned burst = 256;
+    const unsigned srcRate = 8000;
+    unsigned v, resampled;
+    if (!selected("mix")) {
+        return;
+    }
+    short *native = (short *) malloc(outRate * sizeof(short));
+    short *clip = (short *) malloc(srcRate * sizeof(short));
+    fillNoise(native, outRate);
+    fillNoise(clip, srcRate);
+    ResamplerFilter f;
+    bool haveFilter = resamplerFilterInit(&f, srcRate, outRate, RESAMPLER_QUALITY_MEDIUM);
+    for (resampled = 0; resampled <= 1; ++resampled) {
+        if (resampled && !haveFilter) {
+            break;
+        }
+        for (v = 0; v < sizeof(voiceCounts) / sizeof(voiceCounts[0]); ++v) {
+            MixCase c = {.burst = burst};
+            unsigned i;
+            if (!mixerInit(&c.mixer, burst)) {
+                continue;
+            }
+            c.out = (float *) malloc(2 * burst * sizeof(float));
+            for (i = 0; i < voiceCounts[v]; ++i) {
+                if (resampled) {
+                    mixerPlay(&c.mixer, clip, srcRate, 1 << 30, &f, 0.5f, 0, NULL);
+                } else {
+                    mixerPlay(&c.mixer, native, outRate, 1 << 30, NULL, 0.5f, 0, NULL);
+                }
+            }
+            double ns = measure(runMix, &c);
+            char extra[128];
+            snprintf(extra, sizeof(extra), "\"rate\":%u,\"burst\":%u,\"voices\":%u,\"resampled\":%s",
+                     outRate, burst, voiceCounts[v], resampled ? "true" : "false");
+            report("mix", extra, ns, burst, 1e9 * burst / outRate);
+            free(c.out);
+            mixerRelease(&c.mixer);
+        }
+    }
+    if (haveFilter) {
+        resamplerFilterRelease(&f);
+    }
+    free(clip);
+    free(native);
+}
+
+//一个声部一直循环一段短区间（约一个锯齿波周期，每个突发要过几次接缝），
+//接缝处没有交叉淡化或者每次交叉淡化 32 帧；源已经是输出采样率或者需要重采样
+static void benchLoop(unsigned outRate) {
+    static const unsigned crossfades[] = {0, 32};
+    const unsigned burst = 256;
+    const unsigned srcRate = 8000;
+    unsigned x, resampled;
+    if (!selected("loop")) {
+        return;
+    }
+    short *native = (short *) malloc(outRate * sizeof(short));
+    short *clip = (short *) malloc(srcRate * sizeof(short));
+    fillNoise(native, outRate);
+    fillNoise(clip, srcRate);
+    ResamplerFilter f;
+    bool haveFilter = resamplerFilterInit(&f, srcRate, outRate, RESAMPLER_QUALITY_MEDIUM);
+    for (resampled = 0; resampled <= 1; ++resampled) {
+        if (resampled && !haveFilter) {
+            break;
+        }
+        //区间都是 100 个源帧，输出采样率下按比例变长
+        unsigned length = resampled ? 100 : 100 * outRate / srcRate;
+        for (x = 0; x < sizeof(crossfades) / sizeof(crossfades[0]); ++x) {
+            MixCase c = {.burst = burst};
+            if (!mixerInit(&c.mixer, burst)) {
+                continue;
+            }
+            c.out = (float *) malloc(2 * burst * sizeof(float));
+            int voice = resampled
+                        ? mixerPlay(&c.mixer, clip, srcRate, MIXER_LOOP_FOREVER, &f, 0.5f, 0,
+                                    NULL)
+                        : mixerPlay(&c.mixer, native, outRate, MIXER_LOOP_FOREVER, NULL, 0.5f, 0,
+                                    NULL);
+            mixerSetVoiceLoop(&c.mixer, voice, length, 2 * length, crossfades[x]);
+            double ns = measure(runMix, &c);
+            char extra[128];
+            snprintf(extra, sizeof(extra),
+                     "\"rate\":%u,\"burst\":%u,\"loop_frames\":%u,\"crossfade\":%u,"
+                     "\"resampled\":%s", outRate, burst, length, crossfades[x],
+                     resampled ? "true" : "false");
+            report("loop", extra, ns, burst, 1e9 * burst / outRate);
+            free(c.out);
+            mixerRelease(&c.mixer);
+        }
+    }
+    if (haveFilter) {
+        resamplerFilterRelease(&f);
+    }
+    free(clip);
+    free(native);
+}
+
+//同样 4 个声部，源是堆上的 PCM 或者 mmap 进来的 WAV 文件（10 秒，比剪辑缓存的单个条目大得多）。
+//两者应该一样快：映射的页面读过一次后就在页缓存里，声部直接从映射读样本
+static void benchMapped(unsigned outRate) {
+    static const char *sources[] = {"heap", "mmap"};
+    const unsigned burst = 256, voices = 4;
+    unsigned frames = outRate * 10, s, i;
+    if (!selected("mapped")) {
+        return;
+    }
+    char path[] = "/tmp/native-audio-bench-XXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0) {
+        return;
+    }
+    short *pcm = (short *) malloc(frames * sizeof(short));
+    fillNoise(pcm, frames);
+    FILE *file = fdopen(fd, "wb");
+    bool written = file != NULL && wavWriteHeader(file, outRate, 1, 16, frames * sizeof(short)) &&
+                   fwrite(pcm, sizeof(short), frames, file) == frames;
+    if (file != NULL) {
+        fclose(file);
+    } else {
+        close(fd);
+    }
+    MappedWav wav;
+    if (!written || !mappedWavOpen(&wav, path, 0)) {
+        unlink(path);
+        free(pcm);
+        return;
+    }
+    for (s = 0; s < 2; ++s) {
+        MixCase c = {.burst = burst};
+        if (!mixerInit(&c.mixer, burst)) {
+            continue;
+        }
+        c.out = (float *) malloc(2 * burst * sizeof(float));
+        for (i = 0; i < voices; ++i) {
+            mixerPlay(&c.mixer, s == 0 ? pcm : wav.pcm, frames, 1 << 30, NULL, 0.25f, 0,
+                      NULL);
+        }
+        double ns = measure(runMix, &c);
+        char extra[128];
+        snprintf(extra, sizeof(extra),
+                 "\"rate\":%u,\"burst\":%u,\"voices\":%u,\"source\":\"%s\"",
+                 outRate, burst, voices, sources[s]);
+        report("mapped", extra, ns, burst, 1e9 * burst / outRate);
+        free(c.out);
+        mixerRelease(&c.mixer);
+    }
+    mappedWavUnmap(&wav);
+    unlink(path);
+    free(pcm);
+}
+
+typedef struct {
+    AudioDecoderSource source;
+    short *out;
+    unsigned frames;
+} DecodeCase;
+
+//打开、完整解码并关闭一次，和资源第一次放进解码缓存时做的事情相同
+static void runDecode(void *context) {
+    DecodeCase *c = (DecodeCase *) context;
+    AudioDecoder *decoder = audioDecoderOpenWav(&c->source);
+    unsigned done = 0, n;
+    while (decoder != NULL &&
+           (n = audioDecoderRead(decoder, c->out + done, c->frames - done)) > 0) {
+        done += n;
+    }
+    audioDecoderClose(decoder);
+}
+
+//把 10 秒 44.1 kHz 的 WAV 解码成引擎的 16 位单声道 PCM，各种样本格式和声道数。
+//ns_per_frame 按源帧计算，deadline 是解码时间占资源时长的比例
+static void benchDecode(void) {
+    static const struct {
+        const char *name;
+        unsigned channels;
+        unsigned bits;
+    } formats[] = {{"s16", 1, 16}, {"s16", 2, 16}, {"s24", 2, 24}, {"float", 2, 32}};
+    const unsigned rate = 44100, frames = rate * 10;
+    unsigned f, i, c;
+    if (!selected("decode")) {
+        return;
+    }
+    short *noise = (short *) malloc(frames * sizeof(short));
+    short *out = (short *) malloc(frames * sizeof(short));
+    unsigned char *data = (unsigned char *) malloc((size_t) frames * 2 * 4);
+    if (noise == NULL || out == NULL || data == NULL) {
+        free(noise);
+        free(out);
+        free(data);
+        return;
+    }
+    fillNoise(noise, frames);
+    for (f = 0; f < sizeof(formats) / sizeof(formats[0]); ++f) {
+        unsigned bytesPerSample = formats[f].bits / 8;
+        size_t bytes = (size_t) frames * formats[f].channels * bytesPerSample;
+        unsigned char *p = data;
+        //按小端序逐字节写样本，float 按主机表示写出
+        for (i = 0; i < frames; ++i) {
+            for (c = 0; c < formats[f].channels; ++c) {
+                int32_t sample = (int32_t) noise[i] * 65536;
+                if (formats[f].bits == 32) {
+                    float value = noise[i] / 32768.0f;
+                    memcpy(&sample, &value, sizeof(sample));
+                }
+                unsigned k;
+                for (k = 0; k < bytesPerSample; ++k) {
+                    *p++ = (unsigned char) ((uint32_t) sample >> (32 - 8 * bytesPerSample + 8 * k));
+                }
+            }
+        }
+        char path[] = "/tmp/native-audio-bench-XXXXXX";
+        int fd = mkstemp(path);
+        if (fd < 0) {
+            continue;
+        }
+        FILE *file = fdopen(fd, "wb");
+        bool written = file != NULL &&
+                       wavWriteHeader(file, rate, formats[f].channels, formats[f].bits,
+                                      (uint32_t) bytes) &&
+                       fwrite(data, 1, bytes, file) == bytes && fflush(file) == 0;
+        DecodeCase dc = {{fd, 0, (off_t) (WAV_HEADER_BYTES + bytes), 0}, out, frames};
+        if (written) {
+            double ns = measure(runDecode, &dc);
+            char extra[128];
+            snprintf(extra, sizeof(extra),
+                     "\"format\":\"%s\",\"channels\":%u,\"source_rate\":%u",
+                     formats[f].name, formats[f].channels, rate);
+            report("decode", extra, ns, frames, 1e9 * frames / rate);
+        }
+        if (file != NULL) {
+            fclose(file);
+        } else {
+            close(fd);
+        }
+        unlink(path);
+    }
+    free(noise);
+    free(out);
+    free(data);
+}
+
+typedef struct {
+    const float *bus;
+    short *out;
+    unsigned burst;
+    DspDither dither;
+} OutputCase;
+
+static void runOutputS16(void *context) {
+    OutputCase *c = (OutputCase *) context;
+    dsp->f32ToS16(c->bus, c->out, c->burst);
+}
+
+static void runOutputDither(void *context) {
+    OutputCase *c = (OutputCase *) context;
+    dsp->f32ToS16Dither(c->bus, c->out, c->burst, &c->dither);
+}
+
+//float 总线到 int16 的输出级，有无抖动各一次；float 输出没有这一步
+static void benchOutput(unsigned outRate) {
+    static const unsigned bursts[] = {192, 256, 1024};
+    unsigned b, i;
+    if (!selected("output")) {
+        return;
+    }
+    for (b = 0; b < sizeof(bursts) / sizeof(bursts[0]); ++b) {
+        unsigned burst = bursts[b];
+        short *noise = (short *) malloc(burst * sizeof(short));
+        float *bus = (float *) malloc(burst * sizeof(float));
+        OutputCase c = {bus, (short *) malloc(burst * sizeof(short)), burst};
+        if (noise == NULL || bus == NULL || c.out == NULL) {
+            free(noise);
+            free(bus);
+            free(c.out);
+            continue;
+        }
+        fillNoise(noise, burst);
+        for (i = 0; i < burst; ++i) {
+            bus[i] = noise[i] * 0.7f / 32768.0f;
+        }
+        dspDitherInit(&c.dither, 1);
+        char extra[128];
+        snprintf(extra, sizeof(extra), "\"rate\":%u,\"burst\":%u,\"stage\":\"s16\"",
+                 outRate, burst);
+        report("output", extra, measure(runOutputS16, &c), burst, 1e9 * burst / outRate);
+        snprintf(extra, sizeof(extra), "\"rate\":%u,\"burst\":%u,\"stage\":\"s16_dither\"",
+                 outRate, burst);
+        report("output", extra, measure(runOutputDither, &c), burst, 1e9 * burst / outRate);
+        free(noise);
+        free(bus);
+        free(c.out);
+    }
+}
+
+typedef struct {
+    Reverb *reverb;
+    const float *dry;
+    float *bus;
+    unsigned frames;
+    unsigned channels;
+} ReverbCase;
+
+//每次从同一段干声开始，混响的输出不会在总线上越积越大
+static void runReverb(void *context) {
+    ReverbCase *c = (ReverbCase *) context;
+    memcpy(c->bus, c->dry, c->frames * c->channels * sizeof(float));
+    reverbProcess(c->reverb, c->bus, c->frames, c->channels, true);
+}
+
+//混音总线上的混响（STONECORRIDOR），单声道和立体声输出各一次
+static void benchReverb(unsigned outRate) {
+    static const unsigned bursts[] = {192, 256, 1024};
+    unsigned b, channels, i;
+    if (!selected("reverb")) {
+        return;
+    }
+    Reverb reverb;
+    if (!reverbInit(&reverb, outRate)) {
+        return;
+    }
+    for (b = 0; b < sizeof(bursts) / sizeof(bursts[0]); ++b) {
+        unsigned burst = bursts[b];
+        short *noise = (short *) malloc(2 * burst * sizeof(short));
+        float *dry = (float *) malloc(2 * burst * sizeof(float));
+        float *bus = (float *) malloc(2 * burst * sizeof(float));
+        if (noise == NULL || dry == NULL || bus == NULL) {
+            free(noise);
+            free(dry);
+            free(bus);
+            continue;
+        }
+        fillNoise(noise, 2 * burst);
+        for (i = 0; i < 2 * burst; ++i) {
+            dry[i] = noise[i] * 0.5f / 32768.0f;
+        }
+        for (channels = 1; channels <= 2; ++channels) {
+            ReverbCase c = {&reverb, dry, bus, burst, channels};
+            char extra[128];
+            snprintf(extra, sizeof(extra), "\"rate\":%u,\"burst\":%u,\"channels\":%u",
+                     outRate, burst, channels);
+            report("reverb", extra, measure(runReverb, &c), burst, 1e9 * burst / outRate);
+        }
+        free(noise);
+        free(dry);
+        free(bus);
+    }
+    reverbRelease(&reverb);
+}
+
+static void runFill(void *context) {
+    AudioBackend *backend = (AudioBackend *) context;
+    audioBackendPump(backend, backend->burstFrames);
+}
+
+//完整的回调路径：命令处理、所有声部混音、主增益和带抖动的 int16 转换，和设备回调里的代码相同
+static void benchFill(unsigned outRate) {
+    static const unsigned bursts[] = {64, 128, 192, 256, 480, 512, 1024};
+    static const int clips[] = {CLIP_HELLO, CLIP_ANDROID, CLIP_SAWTOOTH, CLIP_HELLO};
+    unsigned b, i;
+    if (!selected("fill")) {
+        return;
+    }
+    AudioEngine *engine = audioEngineCreate();
+    if (engine == NULL) {
+        return;
+    }
+    for (b = 0; b < sizeof(bursts) / sizeof(bursts[0]); ++b) {
+        unsigned burst = bursts[b];
+        if (!audioEngineInit(engine, outRate, burst)) {
+            continue;
+        }
+        AudioBackend *backend = audioBackendCreateNull(outRate, burst, 2, AUDIO_FORMAT_S16,
+                                                       audioEngineRender, engine);
+        if (backend == NULL || !audioBackendStart(backend)) {
+            audioBackendDestroy(backend);
+            continue;
+        }
+        audioEngineSetVolume(engine, -600);
+        for (i = 0; i < sizeof(clips) / sizeof(clips[0]); ++i) {
+            audioEngineSelectClip(engine, clips[i], 1 << 30);
+        }
+        double ns = measure(runFill, backend);
+        char extra[128];
+        snprintf(extra, sizeof(extra), "\"rate\":%u,\"burst\":%u,\"voices\":%u",
+                 outRate, burst, (unsigned) (sizeof(clips) / sizeof(clips[0])));
+        report("fill", extra, ns, burst, 1e9 * burst / outRate);
+        audioEngineSelectClip(engine, CLIP_NONE, 1);
+        audioBackendPump(backend, burst);
+        audioBackendDestroy(backend);
+        audioEngineShutdown(engine);
+    }
+    audioEngineDestroy(engine);
+}
+
+int main(int argc, char **argv) {
+    unsigned outRate = 48000;
+    int i;
+    for (i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+            outRate = (unsigned) strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "-m") == 0 && i + 1 < argc) {
+            minBatchNs = atof(argv[++i]) * 1e6;
+        } else if (argv[i][0] != '-') {
+            filter = argv[i];
+        } else {
+            fprintf(stderr, "usage: native-audio-bench [-r rate] [-m batch_ms] [filter]\n");
+            return 2;
+        }
+    }
+    if (outRate == 0 || minBatchNs <= 0) {
+        return 2;
+    }
+    benchResampleClip(outRate);
+    benchDecimate(outRate);
+    benchMix(outRate);
+    benchLoop(outRate);
+    benchMapped(outRate);
+    benchDecode();
+    benchOutput(outRate);
+    benchReverb(outRate);
+    benchFill(outRate);
+    return 0;
+}
@@ -0,0 +1,115 @@
+#define _POSIX_C_SOURCE 199309L
+
+#include "callback_stats.h"
+
+#include <time.h>
+
+#define SNAPSHOT_RETRIES 8
+
+static uint64_t load(const CallbackStats *stats, CallbackStatsField field) {
+    return atomic_load_explicit((_Atomic uint64_t *) &stats->fields[field], memory_order_relaxed);
+}
+
+static void store(CallbackStats *stats, CallbackStatsField field, uint64_t value) {
+    atomic_store_explicit(&stats->fields[field], value, memory_order_relaxed);
+}
+
+static void add(CallbackStats *stats, CallbackStatsField field, uint64_t value) {
+    //只有回调线程写，不需要 read-modify-write 原子操作
+    store(stats, field, load(stats, field) + value);
+}
+
+static unsigned bucketOf(uint64_t ns) {
+    uint64_t us = ns / 1000;
+    unsigned bucket = 0;
+    while (us != 0 && bucket < CALLBACK_STATS_BUCKETS - 1) {
+        us >>= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+
+void callbackStatsInit(CallbackStats *stats, uint64_t periodNs) {
+    unsigned i;
+    atomic_store_explicit(&stats->sequence, 0, memory_order_relaxed);
+    for (i = 0; i < CALLBACK_STATS_FIELDS; ++i) {
+        store(stats, (CallbackStatsField) i, 0);
+    }
+    store(stats, CALLBACK_STATS_PERIOD_NS, periodNs);
+    store(stats, CALLBACK_STATS_MIN_QUEUE_DEPTH, UINT32_MAX);
+    atomic_thread_fence(memory_order_release);
+}
+
+uint64_t callbackStatsNow(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+void callbackStatsRecord(CallbackStats *stats, uint64_t arrivalNs, uint64_t endNs,
+                         unsigned queueDepth) {
+    unsigned sequence = atomic_load_explicit(&stats->sequence, memory_order_relaxed);
+    uint64_t period = load(stats, CALLBACK_STATS_PERIOD_NS);
+    uint64_t lastArrival = load(stats, CALLBACK_STATS_LAST_ARRIVAL_NS);
+    uint64_t duration = endNs - arrivalNs;
+
+    //序列号为奇数时读者知道数据正在改写
+    atomic_store_explicit(&stats->sequence, sequence + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    add(stats, CALLBACK_STATS_CALLBACKS, 1);
+    if (queueDepth == 0) {
+        add(stats, CALLBACK_STATS_UNDERRUNS, 1);
+    }
+    if (period != 0 && duration > period) {
+        add(stats, CALLBACK_STATS_DEADLINE_MISSES, 1);
+    }
+    //第一次回调没有间隔可算
+    if (lastArrival != 0) {
+        uint64_t interval = arrivalNs - lastArrival;
+        uint64_t jitter = interval > period ? interval - period : period - interval;
+        if (jitter > load(stats, CALLBACK_STATS_MAX_JITTER_NS)) {
+            store(stats, CALLBACK_STATS_MAX_JITTER_NS, jitter);
+        }
+        add(stats, CALLBACK_STATS_SUM_JITTER_NS, jitter);
+        add(stats, CALLBACK_STATS_JITTER_HISTOGRAM + bucketOf(jitter), 1);
+    }
+    if (load(stats, CALLBACK_STATS_FIRST_ARRIVAL_NS) == 0) {
+        store(stats, CALLBACK_STATS_FIRST_ARRIVAL_NS, arrivalNs);
+    }
+    store(stats, CALLBACK_STATS_LAST_ARRIVAL_NS, arrivalNs);
+    store(stats, CALLBACK_STATS_LAST_DURATION_NS, duration);
+    store(stats, CALLBACK_STATS_LAST_QUEUE_DEPTH, queueDepth);
+    if (queueDepth < load(stats, CALLBACK_STATS_MIN_QUEUE_DEPTH)) {
+        store(stats, CALLBACK_STATS_MIN_QUEUE_DEPTH, queueDepth);
+    }
+    if (duration > load(stats, CALLBACK_STATS_MAX_DURATION_NS)) {
+        store(stats, CALLBACK_STATS_MAX_DURATION_NS, duration);
+    }
+    add(stats, CALLBACK_STATS_SUM_DURATION_NS, duration);
+    add(stats, CALLBACK_STATS_DURATION_HISTOGRAM + bucketOf(duration), 1);
+
+    atomic_store_explicit(&stats->sequence, sequence + 2, memory_order_release);
+}
+
+bool callbackStatsSnapshot(const CallbackStats *stats, int64_t *out) {
+    atomic_uint *sequence = (atomic_uint *) &stats->sequence;
+    unsigned attempt, i;
+    for (attempt = 0; attempt < SNAPSHOT_RETRIES; ++attempt) {
+        unsigned before = atomic_load_explicit(sequence, memory_order_acquire);
+        if (before & 1) {
+            continue;
+        }
+        for (i = 0; i < CALLBACK_STATS_FIELDS; ++i) {
+            out[i] = (int64_t) load(stats, (CallbackStatsField) i);
+        }
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(sequence, memory_order_relaxed) == before) {
+            if (out[CALLBACK_STATS_MIN_QUEUE_DEPTH] == UINT32_MAX) {
+                out[CALLBACK_STATS_MIN_QUEUE_DEPTH] = 0;
+            }
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,57 @@
+#ifndef NATIVEAUDIO_CALLBACK_STATS_H
+#define NATIVEAUDIO_CALLBACK_STATS_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+//音频回调的计时统计：每次回调记录到达时刻（CLOCK_MONOTONIC）、处理耗时和进入时的队列深度，
+//汇总成回调间隔抖动和处理耗时两个直方图以及欠载计数。
+//回调线程是唯一的写者，只做 relaxed 原子读写，从不等待；
+//读者用序列号（seqlock）检测读到一半被改写的情况并重试，所以快照不会阻塞音频线程
+
+//直方图按微秒取以 2 为底的对数分桶：第 0 桶 < 1us，第 i 桶 [2^(i-1), 2^i) us，最后一桶不封顶
+#define CALLBACK_STATS_BUCKETS 16
+
+//快照展开成 int64 数组时各字段的下标，JNI 的 getCallbackStats 按这个顺序返回
+typedef enum {
+    CALLBACK_STATS_CALLBACKS = 0,
+    //进入回调时队列里已经没有缓冲区：播放器送出了静音，录音器丢了数据
+    CALLBACK_STATS_UNDERRUNS,
+    //处理耗时超过一个突发时长的次数
+    CALLBACK_STATS_DEADLINE_MISSES,
+    CALLBACK_STATS_PERIOD_NS,
+    CALLBACK_STATS_LAST_ARRIVAL_NS,
+    //第一次回调的到达时刻，播放器用它算出启动到第一个突发播出的时间
+    CALLBACK_STATS_FIRST_ARRIVAL_NS,
+    CALLBACK_STATS_LAST_DURATION_NS,
+    CALLBACK_STATS_LAST_QUEUE_DEPTH,
+    CALLBACK_STATS_MIN_QUEUE_DEPTH,
+    CALLBACK_STATS_MAX_JITTER_NS,
+    CALLBACK_STATS_SUM_JITTER_NS,
+    CALLBACK_STATS_MAX_DURATION_NS,
+    CALLBACK_STATS_SUM_DURATION_NS,
+    CALLBACK_STATS_JITTER_HISTOGRAM,
+    CALLBACK_STATS_DURATION_HISTOGRAM = CALLBACK_STATS_JITTER_HISTOGRAM + CALLBACK_STATS_BUCKETS,
+    CALLBACK_STATS_FIELDS = CALLBACK_STATS_DURATION_HISTOGRAM + CALLBACK_STATS_BUCKETS,
+} CallbackStatsField;
+
+typedef struct CallbackStats {
+    atomic_uint sequence;
+    _Atomic uint64_t fields[CALLBACK_STATS_FIELDS];
+} CallbackStats;
+
+//periodNs 是一个突发的时长，也就是回调的理想间隔
+void callbackStatsInit(CallbackStats *stats, uint64_t periodNs);
+
+uint64_t callbackStatsNow(void);
+
+//回调线程：一次回调结束时调用
+void callbackStatsRecord(CallbackStats *stats, uint64_t arrivalNs, uint64_t endNs,
+                         unsigned queueDepth);
+
+//任意线程：复制一份一致的快照到 out（CALLBACK_STATS_FIELDS 个元素）。
+//回调恰好一直在改写时最多重试几次，仍然失败返回 false
+bool callbackStatsSnapshot(const CallbackStats *stats, int64_t *out);
+
+#endif //NATIVEAUDIO_CALLBACK_STATS_H
@@ -0,0 +1,257 @@
+#include "capture_decimator.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dsp_kernels.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+//各质量档位：半带滤波器偶数相的抽头数（总长度是它的两倍减一）和 Kaiser 窗 beta
+static const struct {
+    unsigned taps;
+    double beta;
+} halfbandTiers[] = {
+        {8,  5.0},
+        {16, 7.0},
+        {32, 9.0},
+};
+
+static double besselI0(double x) {
+    double sum = 1.0, term = 1.0;
+    unsigned k;
+    for (k = 1; k < 50; ++k) {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+        if (term < sum * 1e-12) {
+            break;
+        }
+    }
+    return sum;
+}
+
+//截止在四分之一采样率的半带低通：中心系数 0.5，其余偶数偏移上的系数都是零，
+//只需要保存奇数偏移上的 taps 个系数
+static float *halfbandDesign(unsigned taps, double beta) {
+    float *coeffs = (float *) malloc(taps * sizeof(float));
+    if (coeffs == NULL) {
+        return NULL;
+    }
+    double half = taps;
+    double i0Beta = besselI0(beta);
+    double sum = 0.0;
+    unsigned i;
+    for (i = 0; i < taps; ++i) {
+        //第 i 个系数到中心的距离，总是奇数
+        double n = 2.0 * i - (taps - 1.0);
+        double u = n / half;
+        double w = besselI0(beta * sqrt(1.0 - u * u)) / i0Beta;
+        double h = sin(M_PI * n / 2.0) / (M_PI * n) * w;
+        coeffs[i] = (float) h;
+        sum += h;
+    }
+    //加上中心系数 0.5 后直流增益为 1
+    for (i = 0; i < taps; ++i) {
+        coeffs[i] = (float) (coeffs[i] * 0.5 / sum);
+    }
+    return coeffs;
+}
+
+bool captureDecimatorInit(CaptureDecimator *decimator, unsigned inRate, unsigned outRate,
+                          CaptureFormat format, ResamplerQuality quality, unsigned maxInFrames) {
+    memset(decimator, 0, sizeof(*decimator));
+    if (inRate == 0 || outRate == 0 || maxInFrames == 0 || format > CAPTURE_FORMAT_FLOAT ||
+        quality > RESAMPLER_QUALITY_HIGH) {
+        return false;
+    }
+    decimator->inRate = inRate;
+    decimator->outRate = outRate;
+    decimator->format = format;
+    decimator->maxInFrames = maxInFrames;
+    decimator->taps = halfbandTiers[quality].taps;
+
+    //半带级只做精确的 2:1，抽取后低于目标采样率就停下
+    unsigned rate = inRate, frames = maxInFrames;
+    while (decimator->stageCount < CAPTURE_MAX_HALFBAND_STAGES && rate % 2 == 0 &&
+           rate / 2 >= outRate) {
+        HalfbandStage *stage = &decimator->stages[decimator->stageCount++];
+        unsigned pairs = (frames + 1) / 2;
+        stage->even = (float *) calloc(decimator->taps - 1 + pairs, sizeof(float));
+        stage->odd = (float *) calloc(decimator->taps / 2 + pairs, sizeof(float));
+        if (stage->even == NULL || stage->odd == NULL) {
+            goto fail;
+        }
+        rate /= 2;
+        frames = pairs;
+    }
+    if (decimator->stageCount > 0) {
+        decimator->coeffs = halfbandDesign(decimator->taps, halfbandTiers[quality].beta);
+        if (decimator->coeffs == NULL) {
+            goto fail;
+        }
+    }
+    decimator->resample = rate != outRate;
+    if (decimator->resample) {
+        if (!resamplerFilterInit(&decimator->filter, rate, outRate, quality)) {
+            goto fail;
+        }
+        resamplerInit(&decimator->resampler, &decimator->filter);
+    }
+    decimator->scratch = (float *) malloc(maxInFrames * sizeof(float));
+    decimator->pcm = (short *) malloc(frames * sizeof(short));
+    if (decimator->scratch == NULL || decimator->pcm == NULL) {
+        goto fail;
+    }
+    if (format != CAPTURE_FORMAT_S16) {
+        decimator->native = (short *) malloc(maxInFrames * sizeof(short));
+        if (decimator->native == NULL) {
+            goto fail;
+        }
+    }
+    return true;
+
+    fail:
+    captureDecimatorRelease(decimator);
+    return false;
+}
+
+void captureDecimatorRelease(CaptureDecimator *decimator) {
+    unsigned i;
+    for (i = 0; i < decimator->stageCount; ++i) {
+        free(decimator->stages[i].even);
+        free(decimator->stages[i].odd);
+    }
+    free(decimator->coeffs);
+    free(decimator->scratch);
+    free(decimator->pcm);
+    free(decimator->native);
+    if (decimator->resample) {
+        resamplerFilterRelease(&decimator->filter);
+    }
+    memset(decimator, 0, sizeof(*decimator));
+}
+
+void captureDecimatorReset(CaptureDecimator *decimator) {
+    unsigned i;
+    for (i = 0; i < decimator->stageCount; ++i) {
+        HalfbandStage *stage = &decimator->stages[i];
+        memset(stage->even, 0, (decimator->taps - 1) * sizeof(float));
+        memset(stage->odd, 0, decimator->taps / 2 * sizeof(float));
+        stage->pending = false;
+    }
+    if (decimator->resample) {
+        resamplerReset(&decimator->resampler);
+    }
+}
+
+unsigned captureDecimatorMaxOutput(const CaptureDecimator *decimator) {
+    unsigned i, frames = decimator->maxInFrames;
+    for (i = 0; i < decimator->stageCount; ++i) {
+        frames = (frames + 1) / 2;
+    }
+    //重采样器的相位可能让某一块比平均多出一帧
+    return decimator->resample ? resamplerOutputFrames(&decimator->filter, frames) + 1 : frames;
+}
+
+//原地 2:1 抽取 buf 中的 n 个样本，返回输出个数
+static unsigned halfbandProcess(const CaptureDecimator *decimator, HalfbandStage *stage,
+                                float *buf, unsigned n) {
+    unsigned taps = decimator->taps;
+    //奇数样本只用到中心系数，相对偶数窗口的末尾延迟 taps / 2 个样本
+    unsigned delay = taps / 2;
+    float *even = stage->even + taps - 1;
+    float *odd = stage->odd + delay;
+    unsigned pairs = 0, i = 0, j;
+    if (stage->pending && n > 0) {
+        even[0] = stage->pendingSample;
+        odd[0] = buf[0];
+        stage->pending = false;
+        pairs = 1;
+        i = 1;
+    }
+    unsigned rest = (n - i) / 2;
+    dsp->deinterleave(buf + i, even + pairs, odd + pairs, rest);
+    pairs += rest;
+    i += 2 * rest;
+    if (i < n) {
+        stage->pending = true;
+        stage->pendingSample = buf[i];
+    }
+    //输入已经全部拷走，输出可以覆盖 buf。按抽头而不是按输出循环：每个抽头对整块输出做一次
+    //向量化的乘加，块越大摊到每个样本上的调用开销越小
+    memset(buf, 0, pairs * sizeof(float));
+    for (j = 0; j < taps; ++j) {
+        dsp->mix(buf, stage->even + j, pairs, decimator->coeffs[j]);
+    }
+    dsp->mix(buf, stage->odd, pairs, 0.5f);
+    memmove(stage->even, stage->even + pairs, (taps - 1) * sizeof(float));
+    memmove(stage->odd, stage->odd + pairs, delay * sizeof(float));
+    return pairs;
+}
+
+static void s24ToF32(const unsigned char *src, float *dst, unsigned n) {
+    unsigned i;
+    for (i = 0; i < n; ++i, src += 3) {
+        uint32_t u = (uint32_t) src[0] << 8 | (uint32_t) src[1] << 16 | (uint32_t) src[2] << 24;
+        dst[i] = (float) (int32_t) u * (1.0f / 2147483648.0f);
+    }
+}
+
+unsigned captureDecimatorProcess(CaptureDecimator *decimator, const void *in, unsigned frames,
+                                 short *out) {
+    unsigned i, n = frames;
+    float *buf = decimator->scratch;
+    switch (decimator->format) {
+        case CAPTURE_FORMAT_S16:
+            dsp->s16ToF32((const short *) in, buf, n);
+            break;
+        case CAPTURE_FORMAT_S24:
+            s24ToF32((const unsigned char *) in, buf, n);
+            break;
+        case CAPTURE_FORMAT_FLOAT:
+            memcpy(buf, in, n * sizeof(float));
+            break;
+    }
+    for (i = 0; i < decimator->stageCount; ++i) {
+        n = halfbandProcess(decimator, &decimator->stages[i], buf, n);
+    }
+    if (!decimator->resample) {
+        dsp->f32ToS16(buf, out, n);
+        return n;
+    }
+    dsp->f32ToS16(buf, decimator->pcm, n);
+    unsigned consumed = 0, produced = 0;
+    unsigned limit = captureDecimatorMaxOutput(decimator);
+    while (consumed < n && produced < limit) {
+        unsigned inFrames = n - consumed;
+        produced += resamplerProcess(&decimator->resampler, decimator->pcm + consumed, &inFrames,
+                                     out + produced, limit - produced);
+        consumed += inFrames;
+    }
+    return produced;
+}
+
+const short *captureDecimatorNative(CaptureDecimator *decimator, const void *in,
+                                    unsigned frames) {
+    unsigned i;
+    switch (decimator->format) {
+        case CAPTURE_FORMAT_S16:
+            return (const short *) in;
+        case CAPTURE_FORMAT_S24: {
+            //只取高 16 位，和存储格式的精度一样
+            const unsigned char *src = (const unsigned char *) in;
+            for (i = 0; i < frames; ++i, src += 3) {
+                decimator->native[i] = (short) (uint16_t) (src[1] | src[2] << 8);
+            }
+            break;
+        }
+        case CAPTURE_FORMAT_FLOAT:
+            dsp->f32ToS16((const float *) in, decimator->native, frames);
+            break;
+    }
+    return decimator->native;
+}
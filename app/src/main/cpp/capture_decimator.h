@@ -0,0 +1,73 @@
+#ifndef NATIVEAUDIO_CAPTURE_DECIMATOR_H
+#define NATIVEAUDIO_CAPTURE_DECIMATOR_H
+
+#include <stdbool.h>
+
+#include "resampler.h"
+
+//录音前端：录音器以设备本机采样率和格式采集，这里把单声道输入转换成 int16 存储格式。
+//输入先转成 float，经过若干级半带滤波器逐级 2:1 抽取（只要抽取后仍不低于目标采样率），
+//剩下的非整数比例交给多相重采样器。半带滤波器一半系数为零，奇数样本只乘中心系数
+typedef enum {
+    //16 位带符号整数
+    CAPTURE_FORMAT_S16 = 0,
+    //24 位带符号整数，3 字节紧凑排列，小端序
+    CAPTURE_FORMAT_S24,
+    //32 位浮点，满幅 [-1, 1)
+    CAPTURE_FORMAT_FLOAT,
+} CaptureFormat;
+
+//半带级数上限，96 kHz 到 8 kHz 也只需要三级
+#define CAPTURE_MAX_HALFBAND_STAGES 4
+
+typedef struct {
+    //偶数样本的历史加本次输入，奇数样本的历史加本次输入
+    float *even;
+    float *odd;
+    //上一块输入个数为奇数时留下的最后一个样本
+    bool pending;
+    float pendingSample;
+} HalfbandStage;
+
+typedef struct CaptureDecimator {
+    unsigned inRate;
+    unsigned outRate;
+    CaptureFormat format;
+    unsigned maxInFrames;
+    //偶数相的系数，个数是 4 的倍数
+    float *coeffs;
+    unsigned taps;
+    unsigned stageCount;
+    HalfbandStage stages[CAPTURE_MAX_HALFBAND_STAGES];
+    //半带级之后的采样率等于 outRate 时不需要重采样
+    bool resample;
+    ResamplerFilter filter;
+    Resampler resampler;
+    float *scratch;
+    short *pcm;
+    //captureDecimatorNative 的输出，输入本来就是 16 位时不分配
+    short *native;
+} CaptureDecimator;
+
+//每次处理最多 maxInFrames 帧输入，分配所有缓冲区，之后的处理不再分配内存
+bool captureDecimatorInit(CaptureDecimator *decimator, unsigned inRate, unsigned outRate,
+                          CaptureFormat format, ResamplerQuality quality, unsigned maxInFrames);
+
+void captureDecimatorRelease(CaptureDecimator *decimator);
+
+//清空所有滤波器的历史，开始一路新的录音时调用
+void captureDecimatorReset(CaptureDecimator *decimator);
+
+//一次处理 maxInFrames 帧输入时最多产生的输出帧数
+unsigned captureDecimatorMaxOutput(const CaptureDecimator *decimator);
+
+//录音回调线程：转换 frames 帧输入（frames 不超过 maxInFrames），返回写入 out 的帧数
+unsigned captureDecimatorProcess(CaptureDecimator *decimator, const void *in, unsigned frames,
+                                 short *out);
+
+//录音回调线程：把 frames 帧输入按设备本机采样率转换成 int16，不抽取，给监听这类要低延迟的消费者。
+//输入是 16 位时直接返回 in，否则返回内部缓冲区，下一次调用前有效
+const short *captureDecimatorNative(CaptureDecimator *decimator, const void *in,
+                                    unsigned frames);
+
+#endif //NATIVEAUDIO_CAPTURE_DECIMATOR_H
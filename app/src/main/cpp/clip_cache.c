@@ -0,0 +1,134 @@
+#include "clip_cache.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static size_t entryBytes(const ClipCacheEntry *entry) {
+    return entry->frames * sizeof(short);
+}
+
+static void freeEntry(ClipCache *cache, ClipCacheEntry *entry) {
+    cache->usedBytes -= entryBytes(entry);
+    free(entry->pcm);
+    entry->pcm = NULL;
+    entry->frames = 0;
+    entry->used = false;
+    entry->stale = false;
+}
+
+static bool inUse(ClipCacheEntry *entry) {
+    return atomic_load_explicit(&entry->refs, memory_order_acquire) > 0;
+}
+
+//释放已经失效且不再被声部引用的条目
+static void collect(ClipCache *cache) {
+    unsigned i;
+    for (i = 0; i < CLIP_CACHE_MAX_ENTRIES; ++i) {
+        ClipCacheEntry *entry = &cache->entries[i];
+        if (entry->used && entry->stale && !inUse(entry)) {
+            freeEntry(cache, entry);
+        }
+    }
+}
+
+//淘汰最久未用的空闲条目，直到再放下 bytes 字节不超预算
+static bool makeRoom(ClipCache *cache, size_t bytes) {
+    collect(cache);
+    while (cache->usedBytes + bytes > cache->budgetBytes) {
+        ClipCacheEntry *victim = NULL;
+        unsigned i;
+        for (i = 0; i < CLIP_CACHE_MAX_ENTRIES; ++i) {
+            ClipCacheEntry *entry = &cache->entries[i];
+            if (entry->used && !entry->stale && !inUse(entry) &&
+                (victim == NULL || entry->lastUse < victim->lastUse)) {
+                victim = entry;
+            }
+        }
+        if (victim == NULL) {
+            return false;
+        }
+        freeEntry(cache, victim);
+    }
+    return true;
+}
+
+void clipCacheInit(ClipCache *cache, size_t budgetBytes) {
+    memset(cache, 0, sizeof(*cache));
+    cache->budgetBytes = budgetBytes;
+}
+
+void clipCacheRelease(ClipCache *cache) {
+    unsigned i;
+    for (i = 0; i < CLIP_CACHE_MAX_ENTRIES; ++i) {
+        if (cache->entries[i].used) {
+            freeEntry(cache, &cache->entries[i]);
+        }
+    }
+}
+
+ClipCacheEntry *clipCacheAcquire(ClipCache *cache, int clipId, unsigned outRate) {
+    unsigned i;
+    collect(cache);
+    for (i = 0; i < CLIP_CACHE_MAX_ENTRIES; ++i) {
+        ClipCacheEntry *entry = &cache->entries[i];
+        if (entry->used && !entry->stale && entry->clipId == clipId &&
+            entry->outRate == outRate) {
+            atomic_fetch_add_explicit(&entry->refs, 1, memory_order_relaxed);
+            entry->lastUse = ++cache->useCounter;
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+ClipCacheEntry *clipCacheInsert(ClipCache *cache, int clipId, const short *src,
+                                unsigned srcFrames, const ResamplerFilter *filter) {
+    unsigned frames = resamplerOutputFrames(filter, srcFrames);
+    size_t bytes = frames * sizeof(short);
+    ClipCacheEntry *entry = NULL;
+    unsigned i;
+    if (!makeRoom(cache, bytes)) {
+        return NULL;
+    }
+    for (i = 0; i < CLIP_CACHE_MAX_ENTRIES && entry == NULL; ++i) {
+        if (!cache->entries[i].used) {
+            entry = &cache->entries[i];
+        }
+    }
+    if (entry == NULL) {
+        return NULL;
+    }
+    entry->pcm = (short *) malloc(bytes);
+    if (entry->pcm == NULL) {
+        return NULL;
+    }
+    entry->frames = resamplerConvert(filter, src, srcFrames, entry->pcm);
+    entry->used = true;
+    entry->stale = false;
+    entry->clipId = clipId;
+    entry->outRate = filter->outRate;
+    atomic_store_explicit(&entry->refs, 1, memory_order_relaxed);
+    entry->lastUse = ++cache->useCounter;
+    cache->usedBytes += bytes;
+    return entry;
+}
+
+void clipCacheUnref(ClipCacheEntry *entry) {
+    atomic_fetch_sub_explicit(&entry->refs, 1, memory_order_release);
+}
+
+void clipCacheInvalidate(ClipCache *cache, int clipId) {
+    unsigned i;
+    for (i = 0; i < CLIP_CACHE_MAX_ENTRIES; ++i) {
+        ClipCacheEntry *entry = &cache->entries[i];
+        if (entry->used && (clipId < 0 || entry->clipId == clipId)) {
+            entry->stale = true;
+        }
+    }
+    collect(cache);
+}
+
+void clipCacheSetBudget(ClipCache *cache, size_t budgetBytes) {
+    cache->budgetBytes = budgetBytes;
+    makeRoom(cache, 0);
+}
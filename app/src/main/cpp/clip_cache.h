@@ -0,0 +1,58 @@
+#ifndef NATIVEAUDIO_CLIP_CACHE_H
+#define NATIVEAUDIO_CLIP_CACHE_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "resampler.h"
+
+//已转换剪辑的缓存，按 (剪辑 id, 输出采样率) 索引。
+//每个剪辑在每个输出采样率下只转换一次，之后所有播放共享同一份只读 PCM，
+//重新触发只是把指针交给混音器。总大小受预算限制，超出时淘汰没有声部在用的最久未用条目。
+//除 refs 外所有字段只在控制线程中访问
+#define CLIP_CACHE_MAX_ENTRIES 16
+
+typedef struct ClipCacheEntry {
+    bool used;
+    //失效后不再被查到，等引用计数归零后释放
+    bool stale;
+    int clipId;
+    unsigned outRate;
+    short *pcm;
+    unsigned frames;
+    //正在播放这份 PCM 的声部数，音频回调线程在声部结束时减一
+    atomic_int refs;
+    unsigned lastUse;
+} ClipCacheEntry;
+
+typedef struct ClipCache {
+    ClipCacheEntry entries[CLIP_CACHE_MAX_ENTRIES];
+    size_t budgetBytes;
+    size_t usedBytes;
+    unsigned useCounter;
+} ClipCache;
+
+void clipCacheInit(ClipCache *cache, size_t budgetBytes);
+
+//释放所有条目，调用时不能再有声部在播放
+void clipCacheRelease(ClipCache *cache);
+
+//命中时引用计数加一并返回条目，未命中返回 NULL
+ClipCacheEntry *clipCacheAcquire(ClipCache *cache, int clipId, unsigned outRate);
+
+//用 filter 把 src 转换到 filter->outRate 后插入缓存，引用计数为一。
+//超出预算或没有空位时返回 NULL，调用者应退回到逐突发重采样
+ClipCacheEntry *clipCacheInsert(ClipCache *cache, int clipId, const short *src,
+                                unsigned srcFrames, const ResamplerFilter *filter);
+
+//控制线程放弃一次 Acquire/Insert 得到的引用（命令没有发出去时）
+void clipCacheUnref(ClipCacheEntry *entry);
+
+//使 clipId 的所有条目失效，clipId 为负数时使全部条目失效
+void clipCacheInvalidate(ClipCache *cache, int clipId);
+
+//修改预算，立即淘汰超出的部分
+void clipCacheSetBudget(ClipCache *cache, size_t budgetBytes);
+
+#endif //NATIVEAUDIO_CLIP_CACHE_H
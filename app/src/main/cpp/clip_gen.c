@@ -0,0 +1,189 @@
+//构建时在主机上运行的剪辑生成器：
+//
+//    clip-gen 源目录 输出.c
+//
+//按 clip_registry.h 读取每个剪辑的 <名字>_clip.h，解码成样本，用最高质量的重采样器转换到
+//CLIP_VARIANT_RATES 中的每个采样率，把原始数据和所有转换结果写成 clipVariants 表。
+//样本以十进制数组写出，生成的文件与主机字节序无关，交叉编译时也可以直接使用
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "clip_registry.h"
+#include "dsp_kernels.h"
+#include "resampler.h"
+
+typedef struct {
+    const char *id;
+    const char *name;
+    unsigned sampleRate;
+} ClipSource;
+
+#define CLIP_SOURCE(id, name, rate) {#id, #name, rate},
+static const ClipSource sources[] = {CLIP_REGISTRY(CLIP_SOURCE)};
+static const unsigned variantRates[] = {CLIP_VARIANT_RATES};
+
+static int hexDigit(int c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+//读取相邻的字符串字面量并拼接成字节串，字面量之外的内容（空白、分号）都跳过。
+//只认 \x 十六进制转义和 \\、\"，其它转义说明文件不是预期的格式
+static unsigned char *readClip(const char *path, size_t *bytes) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        fprintf(stderr, "clip-gen: cannot open %s\n", path);
+        return NULL;
+    }
+    size_t capacity = 64 * 1024, size = 0;
+    unsigned char *data = (unsigned char *) malloc(capacity);
+    bool inString = false, ok = true;
+    int c;
+    while (ok && data != NULL && (c = fgetc(file)) != EOF) {
+        if (!inString) {
+            inString = c == '"';
+            continue;
+        }
+        if (c == '"') {
+            inString = false;
+            continue;
+        }
+        if (c == '\\') {
+            c = fgetc(file);
+            if (c == 'x') {
+                int hi = hexDigit(fgetc(file));
+                int lo = hexDigit(fgetc(file));
+                ok = hi >= 0 && lo >= 0;
+                c = hi << 4 | lo;
+            } else {
+                ok = c == '\\' || c == '"';
+            }
+        }
+        if (size == capacity) {
+            capacity *= 2;
+            unsigned char *grown = (unsigned char *) realloc(data, capacity);
+            if (grown == NULL) {
+                free(data);
+                data = NULL;
+                break;
+            }
+            data = grown;
+        }
+        if (data != NULL) {
+            data[size++] = (unsigned char) c;
+        }
+    }
+    fclose(file);
+    if (!ok || data == NULL || inString || size < 2) {
+        fprintf(stderr, "clip-gen: %s is not a PCM string literal\n", path);
+        free(data);
+        return NULL;
+    }
+    *bytes = size;
+    return data;
+}
+
+static void writeArray(FILE *out, const char *name, unsigned rate, const short *pcm,
+                       unsigned frames) {
+    unsigned i;
+    fprintf(out, "static const short %s_%u[%u] = {", name, rate, frames);
+    for (i = 0; i < frames; ++i) {
+        fprintf(out, "%s%d,", i % 12 == 0 ? "\n        " : " ", pcm[i]);
+    }
+    fprintf(out, "\n};\n\n");
+}
+
+int main(int argc, char **argv) {
+    unsigned s, r;
+    if (argc != 3) {
+        fprintf(stderr, "usage: clip-gen source-dir output.c\n");
+        return 2;
+    }
+    dspInit();
+    FILE *out = fopen(argv[2], "w");
+    if (out == NULL) {
+        fprintf(stderr, "clip-gen: cannot create %s\n", argv[2]);
+        return 1;
+    }
+    fprintf(out, "//由 clip-gen 根据 clip_registry.h 生成，不要手工修改\n\n"
+                 "#include \"clip_registry.h\"\n\n");
+
+    //每个剪辑先写原始数据，再写每个预先转换的采样率，表项的顺序与数组相同
+    unsigned counts[sizeof(sources) / sizeof(sources[0])][1 + sizeof(variantRates) /
+                                                            sizeof(variantRates[0])];
+    for (s = 0; s < sizeof(sources) / sizeof(sources[0]); ++s) {
+        const ClipSource *clip = &sources[s];
+        char path[4096];
+        size_t bytes;
+        snprintf(path, sizeof(path), "%s/%s_clip.h", argv[1], clip->name);
+        unsigned char *data = readClip(path, &bytes);
+        if (data == NULL) {
+            fclose(out);
+            remove(argv[2]);
+            return 1;
+        }
+        unsigned frames = (unsigned) (bytes / 2), i;
+        short *pcm = (short *) malloc(frames * sizeof(short));
+        for (i = 0; i < frames; ++i) {
+            pcm[i] = (short) (data[2 * i] | data[2 * i + 1] << 8);
+        }
+        free(data);
+        writeArray(out, clip->name, clip->sampleRate, pcm, frames);
+        counts[s][0] = frames;
+
+        for (r = 0; r < sizeof(variantRates) / sizeof(variantRates[0]); ++r) {
+            counts[s][1 + r] = 0;
+            if (variantRates[r] == clip->sampleRate) {
+                continue;
+            }
+            ResamplerFilter filter;
+            if (!resamplerFilterInit(&filter, clip->sampleRate, variantRates[r],
+                                     RESAMPLER_QUALITY_HIGH)) {
+                fprintf(stderr, "clip-gen: cannot convert %s to %u Hz\n", clip->name,
+                        variantRates[r]);
+                fclose(out);
+                remove(argv[2]);
+                return 1;
+            }
+            short *converted = (short *) malloc(
+                    resamplerOutputFrames(&filter, frames) * sizeof(short));
+            counts[s][1 + r] = resamplerConvert(&filter, pcm, frames, converted);
+            writeArray(out, clip->name, variantRates[r], converted, counts[s][1 + r]);
+            free(converted);
+            resamplerFilterRelease(&filter);
+        }
+        free(pcm);
+    }
+
+    fprintf(out, "const ClipVariant clipVariants[] = {\n");
+    for (s = 0; s < sizeof(sources) / sizeof(sources[0]); ++s) {
+        const ClipSource *clip = &sources[s];
+        fprintf(out, "        {%s, \"%s\", %u, true, %s_%u, %u},\n", clip->id, clip->name,
+                clip->sampleRate, clip->name, clip->sampleRate, counts[s][0]);
+        for (r = 0; r < sizeof(variantRates) / sizeof(variantRates[0]); ++r) {
+            if (counts[s][1 + r] > 0) {
+                fprintf(out, "        {%s, \"%s\", %u, false, %s_%u, %u},\n", clip->id,
+                        clip->name, variantRates[r], clip->name, variantRates[r],
+                        counts[s][1 + r]);
+            }
+        }
+    }
+    fprintf(out, "};\n\nconst unsigned clipVariantCount = sizeof(clipVariants) / "
+                 "sizeof(clipVariants[0]);\n");
+    if (fclose(out) != 0) {
+        remove(argv[2]);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,23 @@
+#include "clip_registry.h"
+
+#include <stddef.h>
+
+const ClipVariant *clipRegistryFind(int id, unsigned sampleRate) {
+    unsigned i;
+    for (i = 0; i < clipVariantCount; ++i) {
+        if (clipVariants[i].id == id && clipVariants[i].sampleRate == sampleRate) {
+            return &clipVariants[i];
+        }
+    }
+    return NULL;
+}
+
+const ClipVariant *clipRegistrySource(int id) {
+    unsigned i;
+    for (i = 0; i < clipVariantCount; ++i) {
+        if (clipVariants[i].id == id && clipVariants[i].source) {
+            return &clipVariants[i];
+        }
+    }
+    return NULL;
+}
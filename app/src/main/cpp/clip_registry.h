@@ -0,0 +1,52 @@
+#ifndef NATIVEAUDIO_CLIP_REGISTRY_H
+#define NATIVEAUDIO_CLIP_REGISTRY_H
+
+#include <stdbool.h>
+
+//内置剪辑的采样率
+#define CLIP_SAMPLE_RATE 8000
+
+//内置剪辑表：每行一个剪辑，CLIP(编号, 名字, 源采样率)。
+//名字对应本目录下的 <名字>_clip.h，内容是 C 字符串字面量形式的 16 位单声道小端序 PCM。
+//构建时 clip-gen 读取这些文件，生成 clip_data.c：原始数据，加上 CLIP_VARIANT_RATES 里
+//每个输出采样率预先转换好的版本。常见设备的输出采样率因此在运行时不需要任何转换。
+//增加一个内置声音只需要放一个 <名字>_clip.h 再在这里加一行，编号由下面的枚举按表中的顺序生成
+#define CLIP_REGISTRY(CLIP) \
+        CLIP(CLIP_HELLO, hello, CLIP_SAMPLE_RATE) \
+        CLIP(CLIP_ANDROID, android, CLIP_SAMPLE_RATE) \
+        CLIP(CLIP_SAWTOOTH, sawtooth, CLIP_SAMPLE_RATE)
+
+//剪辑编号：CLIP_NONE 是 0，内置剪辑从 1 开始，录音回放排在最后。
+//Java 层的常量与这里的值一一对应，新剪辑加在表的末尾时只有 CLIP_PLAYBACK 的值会变
+#define CLIP_ID(id, name, rate) id,
+enum {
+    CLIP_NONE,
+    CLIP_REGISTRY(CLIP_ID)
+    CLIP_PLAYBACK,
+};
+#undef CLIP_ID
+
+//预先转换的输出采样率，其它采样率仍然在第一次播放时转换并放进剪辑缓存
+#define CLIP_VARIANT_RATES 44100, 48000
+
+typedef struct ClipVariant {
+    int id;
+    const char *name;
+    unsigned sampleRate;
+    //为 true 时是原始数据，否则是从原始数据转换来的
+    bool source;
+    const short *pcm;
+    unsigned frames;
+} ClipVariant;
+
+//由 clip-gen 生成
+extern const ClipVariant clipVariants[];
+extern const unsigned clipVariantCount;
+
+//剪辑 id 在 sampleRate 下的数据（原始数据或者预先转换的版本），没有时返回 NULL
+const ClipVariant *clipRegistryFind(int id, unsigned sampleRate);
+
+//剪辑 id 的原始数据，未知的 id 返回 NULL
+const ClipVariant *clipRegistrySource(int id);
+
+#endif //NATIVEAUDIO_CLIP_REGISTRY_H
@@ -0,0 +1,281 @@
+#include "decoded_cache.h"
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+//立体声解码时每次读这么多帧到栈上的交错缓冲区，再拆进两个声道平面
+#define DECODE_SCRATCH_FRAMES 1024
+
+static size_t entryBytes(const DecodedAsset *asset) {
+    return (size_t) asset->frames * asset->channels * sizeof(short);
+}
+
+static void freeEntry(DecodedCache *cache, DecodedAsset *asset) {
+    if (asset->threadRunning) {
+        atomic_store(&asset->cancel, true);
+        pthread_join(asset->thread, NULL);
+        asset->threadRunning = false;
+    }
+    audioDecoderClose(asset->decoder);
+    asset->decoder = NULL;
+    cache->usedBytes -= entryBytes(asset);
+    free(asset->pcm);
+    asset->pcm = NULL;
+    asset->frames = 0;
+    atomic_store_explicit(&asset->ready, 0, memory_order_relaxed);
+    asset->used = false;
+}
+
+static bool inUse(DecodedAsset *asset) {
+    return atomic_load_explicit(&asset->refs, memory_order_acquire) > 0;
+}
+
+//淘汰最久未用的空闲条目，还在解码的条目也可以淘汰，先停掉它的线程。没有空闲条目时返回 false
+static bool evictOldest(DecodedCache *cache) {
+    DecodedAsset *victim = NULL;
+    unsigned i;
+    for (i = 0; i < DECODED_CACHE_MAX_ENTRIES; ++i) {
+        DecodedAsset *asset = &cache->entries[i];
+        if (asset->used && !inUse(asset) &&
+            (victim == NULL || asset->lastUse < victim->lastUse)) {
+            victim = asset;
+        }
+    }
+    if (victim == NULL) {
+        return false;
+    }
+    freeEntry(cache, victim);
+    return true;
+}
+
+//淘汰空闲条目，直到再放下 bytes 字节不超预算
+static bool makeRoom(DecodedCache *cache, size_t bytes) {
+    while (cache->usedBytes + bytes > cache->budgetBytes) {
+        if (!evictOldest(cache)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//找一个空位，都占满时淘汰一个空闲条目
+static DecodedAsset *freeSlot(DecodedCache *cache) {
+    do {
+        unsigned i;
+        for (i = 0; i < DECODED_CACHE_MAX_ENTRIES; ++i) {
+            if (!cache->entries[i].used) {
+                return &cache->entries[i];
+            }
+        }
+    } while (evictOldest(cache));
+    return NULL;
+}
+
+//解码 frames 帧，写到 pcm 中每个声道平面的第 offset 帧处，平面之间相隔 stride 帧。
+//解码器提前结束时返回实际的帧数。
+//cancel 不为 NULL 时每读一次检查一次，置位后立即返回，freeEntry 的 join 不会等整块解码完
+static unsigned decodeInto(AudioDecoder *decoder, short *pcm, size_t stride, unsigned offset,
+                           unsigned frames, const atomic_bool *cancel) {
+    short scratch[2 * DECODE_SCRATCH_FRAMES];
+    unsigned done = 0, i;
+    while (done < frames &&
+           (cancel == NULL || !atomic_load_explicit(cancel, memory_order_relaxed))) {
+        short *left = pcm + offset + done;
+        unsigned n;
+        if (decoder->stereo) {
+            unsigned want = frames - done;
+            n = audioDecoderRead(decoder, scratch,
+                                 want < DECODE_SCRATCH_FRAMES ? want : DECODE_SCRATCH_FRAMES);
+            for (i = 0; i < n; ++i) {
+                left[i] = scratch[2 * i];
+                left[stride + i] = scratch[2 * i + 1];
+            }
+        } else {
+            n = audioDecoderRead(decoder, left, frames - done);
+        }
+        if (n == 0) {
+            break;
+        }
+        done += n;
+    }
+    return done;
+}
+
+//解码器不知道总帧数时只能同步解码到一个逐渐加倍的缓冲区，返回帧数，失败时返回 0。
+//平面之间相隔 capacity 帧，加倍时把右声道的平面挪到新的位置，解码完再紧挨着左声道放
+static unsigned decodeUnbounded(AudioDecoder *decoder, unsigned channels, size_t budgetBytes,
+                                short **pcm) {
+    size_t capacity = DECODED_CACHE_CHUNK_FRAMES;
+    size_t frames = 0;
+    short *buffer = NULL;
+    for (;;) {
+        if (frames == capacity) {
+            capacity *= 2;
+        }
+        if (capacity * channels * sizeof(short) > budgetBytes || capacity > UINT_MAX) {
+            break;
+        }
+        short *grown = (short *) realloc(buffer, capacity * channels * sizeof(short));
+        if (grown == NULL) {
+            break;
+        }
+        buffer = grown;
+        if (channels == 2) {
+            memmove(buffer + capacity, buffer + frames, frames * sizeof(short));
+        }
+        unsigned n = decodeInto(decoder, buffer, capacity, (unsigned) frames,
+                                (unsigned) (capacity - frames), NULL);
+        frames += n;
+        if (frames < capacity) {
+            if (channels == 2) {
+                memmove(buffer + frames, buffer + capacity, frames * sizeof(short));
+            }
+            *pcm = buffer;
+            return (unsigned) frames;
+        }
+    }
+    free(buffer);
+    return 0;
+}
+
+//渐进解码：每解码一块发布一次 ready。估计的总帧数比实际多时剩下的补静音，
+//声部读到的帧数总是 frames，不会停在一个永远不会到来的 ready 上
+static void *decodeThread(void *arg) {
+    DecodedAsset *asset = (DecodedAsset *) arg;
+    unsigned done = atomic_load_explicit(&asset->ready, memory_order_relaxed);
+    unsigned c;
+    while (done < asset->frames && !atomic_load_explicit(&asset->cancel, memory_order_relaxed)) {
+        unsigned want = asset->frames - done;
+        if (want > DECODED_CACHE_CHUNK_FRAMES) {
+            want = DECODED_CACHE_CHUNK_FRAMES;
+        }
+        unsigned n = decodeInto(asset->decoder, asset->pcm, asset->frames, done, want,
+                                &asset->cancel);
+        if (atomic_load_explicit(&asset->cancel, memory_order_relaxed)) {
+            break;
+        }
+        if (n < want) {
+            for (c = 0; c < asset->channels; ++c) {
+                memset(asset->pcm + (size_t) c * asset->frames + done + n, 0,
+                       (asset->frames - done - n) * sizeof(short));
+            }
+            done = asset->frames;
+        } else {
+            done += n;
+        }
+        atomic_store_explicit(&asset->ready, done, memory_order_release);
+    }
+    audioDecoderClose(asset->decoder);
+    asset->decoder = NULL;
+    return NULL;
+}
+
+void decodedCacheInit(DecodedCache *cache, size_t budgetBytes) {
+    memset(cache, 0, sizeof(*cache));
+    cache->budgetBytes = budgetBytes;
+}
+
+void decodedCacheRelease(DecodedCache *cache) {
+    unsigned i;
+    for (i = 0; i < DECODED_CACHE_MAX_ENTRIES; ++i) {
+        if (cache->entries[i].used) {
+            freeEntry(cache, &cache->entries[i]);
+        }
+    }
+}
+
+DecodedAsset *decodedCacheFind(DecodedCache *cache, const char *key) {
+    unsigned i;
+    for (i = 0; i < DECODED_CACHE_MAX_ENTRIES; ++i) {
+        DecodedAsset *asset = &cache->entries[i];
+        if (asset->used && strcmp(asset->key, key) == 0) {
+            return asset;
+        }
+    }
+    return NULL;
+}
+
+DecodedAsset *decodedCacheAcquire(DecodedCache *cache, const char *key) {
+    DecodedAsset *asset = decodedCacheFind(cache, key);
+    if (asset != NULL) {
+        atomic_fetch_add_explicit(&asset->refs, 1, memory_order_relaxed);
+        asset->lastUse = ++cache->useCounter;
+    }
+    return asset;
+}
+
+DecodedAsset *decodedCacheInsert(DecodedCache *cache, const char *key, AudioDecoder *decoder,
+                                 bool progressive) {
+    DecodedAsset *asset = NULL;
+    short *pcm = NULL;
+    unsigned frames = 0;
+    unsigned ready = 0;
+    unsigned channels = audioDecoderKeepStereo(decoder) ? 2 : 1;
+    size_t frameBytes = channels * sizeof(short);
+    if (strlen(key) < DECODED_CACHE_KEY_BYTES && decodedCacheFind(cache, key) == NULL) {
+        asset = freeSlot(cache);
+    }
+    if (asset != NULL && decoder->frames == 0) {
+        frames = ready = decodeUnbounded(decoder, channels, cache->budgetBytes, &pcm);
+        progressive = false;
+        if (frames > 0 && !makeRoom(cache, frames * frameBytes)) {
+            frames = 0;
+        }
+    } else if (asset != NULL && decoder->frames <= UINT_MAX &&
+               makeRoom(cache, (size_t) decoder->frames * frameBytes) &&
+               (pcm = (short *) malloc((size_t) decoder->frames * frameBytes)) != NULL) {
+        frames = (unsigned) decoder->frames;
+        //渐进解码先同步解码第一块，剩下的交给后台线程；同步解码按实际解码出的帧数截短
+        progressive = progressive && frames > DECODED_CACHE_CHUNK_FRAMES;
+        ready = decodeInto(decoder, pcm, frames, 0,
+                           progressive ? DECODED_CACHE_CHUNK_FRAMES : frames, NULL);
+        if (!progressive || ready < DECODED_CACHE_CHUNK_FRAMES) {
+            if (channels == 2) {
+                memmove(pcm + ready, pcm + frames, ready * sizeof(short));
+            }
+            frames = ready;
+            progressive = false;
+        }
+    }
+    if (frames == 0) {
+        free(pcm);
+        audioDecoderClose(decoder);
+        return NULL;
+    }
+    //平台解码器可能在解码出第一块时才知道输出的采样率
+    unsigned sampleRate = decoder->sampleRate;
+    if (!progressive) {
+        audioDecoderClose(decoder);
+        decoder = NULL;
+    }
+    strcpy(asset->key, key);
+    asset->pcm = pcm;
+    asset->frames = frames;
+    asset->channels = channels;
+    asset->sampleRate = sampleRate;
+    asset->decoder = decoder;
+    atomic_store_explicit(&asset->ready, ready, memory_order_relaxed);
+    atomic_store_explicit(&asset->cancel, false, memory_order_relaxed);
+    atomic_store_explicit(&asset->refs, 1, memory_order_relaxed);
+    asset->lastUse = ++cache->useCounter;
+    asset->used = true;
+    cache->usedBytes += entryBytes(asset);
+    if (decoder != NULL) {
+        asset->threadRunning = pthread_create(&asset->thread, NULL, decodeThread, asset) == 0;
+        //没有线程可用时就地解码完
+        if (!asset->threadRunning) {
+            decodeThread(asset);
+        }
+    }
+    return asset;
+}
+
+void decodedCacheUnref(DecodedAsset *asset) {
+    atomic_fetch_sub_explicit(&asset->refs, 1, memory_order_release);
+}
+
+void decodedCacheSetBudget(DecodedCache *cache, size_t budgetBytes) {
+    cache->budgetBytes = budgetBytes;
+    makeRoom(cache, 0);
+}
@@ -0,0 +1,74 @@
+#ifndef NATIVEAUDIO_DECODED_CACHE_H
+#define NATIVEAUDIO_DECODED_CACHE_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "audio_decoder.h"
+
+//解码后资源的缓存，按调用方给的键（例如资源文件名）索引。
+//每个资源只解码一次，成为源采样率下的 16 位 PCM，之后所有播放共享同一份，像内置剪辑一样混音。
+//立体声的源保留左右声道，按声道分成两个平面存放，每个平面和单声道的 PCM 一样由一个声部播放。
+//渐进解码时后台线程逐块写入 pcm，每块写完后发布 ready，声部只读 ready 之前的帧，
+//所以不用等整个文件解码完就可以开始播放。总大小受预算限制，超出时淘汰没有声部在用的最久未用条目。
+//除 refs/ready 外所有字段只在控制线程中访问（由调用方加锁）
+#define DECODED_CACHE_MAX_ENTRIES 8
+#define DECODED_CACHE_KEY_BYTES 256
+//后台线程每次解码这么多帧再发布一次 ready；渐进解码时第一块在插入时同步解码，播放一开始就有数据
+#define DECODED_CACHE_CHUNK_FRAMES 8192
+
+typedef struct DecodedAsset {
+    bool used;
+    char key[DECODED_CACHE_KEY_BYTES];
+    //channels 个声道平面，每个 frames 帧，第 c 个声道从 pcm + c * frames 开始
+    short *pcm;
+    unsigned frames;
+    //1 或 2
+    unsigned channels;
+    unsigned sampleRate;
+    //已经解码好的帧数，解码线程用 release 写入，音频回调用 acquire 读取；解码完成时等于 frames
+    atomic_uint ready;
+    //正在播放这份 PCM 的声部数，音频回调线程在声部结束时减一
+    atomic_int refs;
+    unsigned lastUse;
+    //渐进解码的后台线程，解码器归它所有，解码完成后关闭
+    AudioDecoder *decoder;
+    pthread_t thread;
+    bool threadRunning;
+    atomic_bool cancel;
+} DecodedAsset;
+
+typedef struct DecodedCache {
+    DecodedAsset entries[DECODED_CACHE_MAX_ENTRIES];
+    size_t budgetBytes;
+    size_t usedBytes;
+    unsigned useCounter;
+} DecodedCache;
+
+void decodedCacheInit(DecodedCache *cache, size_t budgetBytes);
+
+//停止所有解码线程并释放所有条目，调用时不能再有声部在播放
+void decodedCacheRelease(DecodedCache *cache);
+
+//命中时引用计数加一并返回条目，未命中返回 NULL
+DecodedAsset *decodedCacheAcquire(DecodedCache *cache, const char *key);
+
+//不加引用，只看 key 是否在缓存里（可能还在解码）
+DecodedAsset *decodedCacheFind(DecodedCache *cache, const char *key);
+
+//用 decoder 解码出 key 对应的资源并插入缓存，引用计数为一；decoder 总是归缓存所有，
+//立体声的源由缓存打开 audioDecoderKeepStereo。
+//progressive 为 false 或者解码器不知道总帧数时同步解码完才返回，否则后台线程继续解码。
+//键太长、超出预算、没有空位或解码失败时返回 NULL
+DecodedAsset *decodedCacheInsert(DecodedCache *cache, const char *key, AudioDecoder *decoder,
+                                 bool progressive);
+
+//控制线程放弃一次 Acquire/Insert 得到的引用（命令没有发出去时）
+void decodedCacheUnref(DecodedAsset *asset);
+
+//修改预算，立即淘汰超出的部分
+void decodedCacheSetBudget(DecodedCache *cache, size_t budgetBytes);
+
+#endif //NATIVEAUDIO_DECODED_CACHE_H
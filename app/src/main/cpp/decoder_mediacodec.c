@@ -0,0 +1,220 @@
+#include "decoder_mediacodec.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <media/NdkMediaCodec.h>
+#include <media/NdkMediaExtractor.h>
+#include <media/NdkMediaFormat.h>
+
+//等待输入/输出缓冲区的超时，解码在后台线程里进行，不需要很短
+#define MEDIACODEC_TIMEOUT_US 10000
+//连续这么多轮既送不进输入也取不到输出，就认为解码器卡住了，按流结束处理，读取不会无限等下去
+#define MEDIACODEC_MAX_IDLE_POLLS 200
+
+typedef struct {
+    AudioDecoder base;
+    int fd;
+    AMediaExtractor *extractor;
+    AMediaCodec *codec;
+    bool inputDone;
+    bool outputDone;
+    //输出缓冲区的声道数，可能和音轨格式不同，以 INFO_OUTPUT_FORMAT_CHANGED 为准
+    unsigned outputChannels;
+    //还没交出去的输出缓冲区，交完后才还给解码器
+    ssize_t outputIndex;
+    const short *pending;
+    size_t pendingFrames;
+} MediaCodecDecoder;
+
+//把 extractor 的下一个压缩帧送进解码器，没有了就送流结束标志。没有空闲的输入缓冲区时返回 false
+static bool feedInput(MediaCodecDecoder *mc) {
+    ssize_t index = AMediaCodec_dequeueInputBuffer(mc->codec, MEDIACODEC_TIMEOUT_US);
+    if (index < 0) {
+        return false;
+    }
+    size_t capacity;
+    uint8_t *buffer = AMediaCodec_getInputBuffer(mc->codec, (size_t) index, &capacity);
+    ssize_t size = buffer != NULL
+                   ? AMediaExtractor_readSampleData(mc->extractor, buffer, capacity) : -1;
+    if (size < 0) {
+        AMediaCodec_queueInputBuffer(mc->codec, (size_t) index, 0, 0, 0,
+                                     AMEDIACODEC_BUFFER_FLAG_END_OF_STREAM);
+        mc->inputDone = true;
+        return true;
+    }
+    AMediaCodec_queueInputBuffer(mc->codec, (size_t) index, 0, (size_t) size,
+                                 (uint64_t) AMediaExtractor_getSampleTime(mc->extractor), 0);
+    AMediaExtractor_advance(mc->extractor);
+    return true;
+}
+
+static void updateOutputFormat(MediaCodecDecoder *mc) {
+    AMediaFormat *format = AMediaCodec_getOutputFormat(mc->codec);
+    int32_t value;
+    if (format == NULL) {
+        return;
+    }
+    if (AMediaFormat_getInt32(format, AMEDIAFORMAT_KEY_CHANNEL_COUNT, &value) && value > 0) {
+        mc->outputChannels = (unsigned) value;
+    }
+    if (AMediaFormat_getInt32(format, AMEDIAFORMAT_KEY_SAMPLE_RATE, &value) && value > 0) {
+        mc->base.sampleRate = (unsigned) value;
+    }
+    AMediaFormat_delete(format);
+}
+
+//取下一个输出缓冲区放进 pending。流结束或者出错时置 outputDone。什么都没取到时返回 false
+static bool drainOutput(MediaCodecDecoder *mc) {
+    AMediaCodecBufferInfo info;
+    ssize_t index = AMediaCodec_dequeueOutputBuffer(mc->codec, &info, MEDIACODEC_TIMEOUT_US);
+    if (index == AMEDIACODEC_INFO_OUTPUT_FORMAT_CHANGED) {
+        updateOutputFormat(mc);
+        return true;
+    }
+    if (index == AMEDIACODEC_INFO_TRY_AGAIN_LATER ||
+        index == AMEDIACODEC_INFO_OUTPUT_BUFFERS_CHANGED) {
+        return false;
+    }
+    if (index < 0) {
+        mc->outputDone = true;
+        return true;
+    }
+    size_t size;
+    uint8_t *buffer = AMediaCodec_getOutputBuffer(mc->codec, (size_t) index, &size);
+    if (info.flags & AMEDIACODEC_BUFFER_FLAG_END_OF_STREAM) {
+        mc->outputDone = true;
+    }
+    if (buffer != NULL && info.size > 0) {
+        mc->outputIndex = index;
+        mc->pending = (const short *) (buffer + info.offset);
+        mc->pendingFrames = (size_t) info.size / (sizeof(short) * mc->outputChannels);
+    }
+    if (mc->pendingFrames == 0) {
+        AMediaCodec_releaseOutputBuffer(mc->codec, (size_t) index, false);
+    }
+    return true;
+}
+
+static unsigned mediaCodecRead(AudioDecoder *decoder, short *dst, unsigned frames) {
+    MediaCodecDecoder *mc = (MediaCodecDecoder *) decoder;
+    unsigned written = 0, idle = 0;
+    while (written < frames) {
+        if (mc->pendingFrames > 0) {
+            unsigned n = frames - written;
+            if (n > mc->pendingFrames) {
+                n = (unsigned) mc->pendingFrames;
+            }
+            if (decoder->stereo) {
+                audioDecoderStereoS16(mc->pending, mc->outputChannels, dst + 2 * written, n);
+            } else {
+                audioDecoderDownmixS16(mc->pending, mc->outputChannels, dst + written, n);
+            }
+            mc->pending += (size_t) n * mc->outputChannels;
+            mc->pendingFrames -= n;
+            written += n;
+            if (mc->pendingFrames == 0) {
+                AMediaCodec_releaseOutputBuffer(mc->codec, (size_t) mc->outputIndex, false);
+            }
+            continue;
+        }
+        if (mc->outputDone) {
+            break;
+        }
+        bool progress = !mc->inputDone && feedInput(mc);
+        progress = drainOutput(mc) || progress;
+        if (progress) {
+            idle = 0;
+        } else if (++idle >= MEDIACODEC_MAX_IDLE_POLLS) {
+            mc->outputDone = true;
+        }
+    }
+    return written;
+}
+
+static void mediaCodecClose(AudioDecoder *decoder) {
+    MediaCodecDecoder *mc = (MediaCodecDecoder *) decoder;
+    if (mc->codec != NULL) {
+        if (mc->pendingFrames > 0) {
+            AMediaCodec_releaseOutputBuffer(mc->codec, (size_t) mc->outputIndex, false);
+        }
+        AMediaCodec_stop(mc->codec);
+        AMediaCodec_delete(mc->codec);
+    }
+    if (mc->extractor != NULL) {
+        AMediaExtractor_delete(mc->extractor);
+    }
+    if (mc->fd >= 0) {
+        close(mc->fd);
+    }
+    free(mc);
+}
+
+static const AudioDecoderOps mediaCodecOps = {
+        "mediacodec", mediaCodecRead, mediaCodecClose,
+};
+
+//选中第一条音轨并按它的格式创建解码器
+static bool openTrack(MediaCodecDecoder *mc) {
+    size_t tracks = AMediaExtractor_getTrackCount(mc->extractor);
+    size_t i;
+    for (i = 0; i < tracks; ++i) {
+        AMediaFormat *format = AMediaExtractor_getTrackFormat(mc->extractor, i);
+        const char *mime = NULL;
+        int32_t rate = 0, channels = 0;
+        int64_t durationUs = 0;
+        if (format == NULL) {
+            continue;
+        }
+        if (!AMediaFormat_getString(format, AMEDIAFORMAT_KEY_MIME, &mime) ||
+            strncmp(mime, "audio/", 6) != 0 ||
+            !AMediaFormat_getInt32(format, AMEDIAFORMAT_KEY_SAMPLE_RATE, &rate) ||
+            !AMediaFormat_getInt32(format, AMEDIAFORMAT_KEY_CHANNEL_COUNT, &channels) ||
+            rate <= 0 || channels <= 0) {
+            AMediaFormat_delete(format);
+            continue;
+        }
+        mc->base.sampleRate = (unsigned) rate;
+        mc->base.channels = (unsigned) channels;
+        mc->outputChannels = (unsigned) channels;
+        if (AMediaFormat_getInt64(format, AMEDIAFORMAT_KEY_DURATION, &durationUs) &&
+            durationUs > 0) {
+            mc->base.frames = (uint64_t) durationUs * (uint64_t) rate / 1000000;
+        }
+        mc->codec = AMediaCodec_createDecoderByType(mime);
+        bool ok = mc->codec != NULL &&
+                  AMediaExtractor_selectTrack(mc->extractor, i) == AMEDIA_OK &&
+                  AMediaCodec_configure(mc->codec, format, NULL, NULL, 0) == AMEDIA_OK &&
+                  AMediaCodec_start(mc->codec) == AMEDIA_OK;
+        AMediaFormat_delete(format);
+        if (!ok && mc->codec != NULL) {
+            AMediaCodec_delete(mc->codec);
+            mc->codec = NULL;
+        }
+        return ok;
+    }
+    return false;
+}
+
+AudioDecoder *audioDecoderOpenMediaCodec(const AudioDecoderSource *source) {
+    if (source->fd < 0 || source->length <= 0) {
+        return NULL;
+    }
+    MediaCodecDecoder *mc = (MediaCodecDecoder *) calloc(1, sizeof(MediaCodecDecoder));
+    if (mc == NULL) {
+        return NULL;
+    }
+    mc->base.ops = &mediaCodecOps;
+    mc->outputIndex = -1;
+    mc->fd = dup(source->fd);
+    mc->extractor = mc->fd >= 0 ? AMediaExtractor_new() : NULL;
+    if (mc->extractor == NULL ||
+        AMediaExtractor_setDataSourceFd(mc->extractor, mc->fd, source->start,
+                                        source->length) != AMEDIA_OK ||
+        !openTrack(mc)) {
+        mediaCodecClose(&mc->base);
+        return NULL;
+    }
+    return &mc->base;
+}
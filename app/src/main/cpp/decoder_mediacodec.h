@@ -0,0 +1,11 @@
+#ifndef NATIVEAUDIO_DECODER_MEDIACODEC_H
+#define NATIVEAUDIO_DECODER_MEDIACODEC_H
+
+#include "audio_decoder.h"
+
+//Android 上的压缩格式解码器（MP3、AAC、Vorbis 等）：AMediaExtractor 拆出第一条音轨，
+//AMediaCodec 同步解码成 16 位 PCM，再混成单声道交给调用方。总帧数按音轨时长估计。
+//打开时 dup 一份 fd，关闭解码器时才关闭
+AudioDecoder *audioDecoderOpenMediaCodec(const AudioDecoderSource *source);
+
+#endif //NATIVEAUDIO_DECODER_MEDIACODEC_H
@@ -0,0 +1,225 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "audio_decoder.h"
+
+//WAVE_FORMAT_PCM / WAVE_FORMAT_IEEE_FLOAT / WAVE_FORMAT_EXTENSIBLE
+#define WAV_FORMAT_PCM 1
+#define WAV_FORMAT_FLOAT 3
+#define WAV_FORMAT_EXTENSIBLE 0xFFFE
+
+typedef struct {
+    AudioDecoder base;
+    void *mapping;
+    size_t mappingBytes;
+    const unsigned char *data;
+    bool floating;
+    unsigned bytesPerSample;
+    unsigned blockAlign;
+    uint64_t position;
+} WavDecoder;
+
+static unsigned getLe16(const unsigned char *p) {
+    return p[0] | (unsigned) p[1] << 8;
+}
+
+static uint32_t getLe32(const unsigned char *p) {
+    return p[0] | (uint32_t) p[1] << 8 | (uint32_t) p[2] << 16 | (uint32_t) p[3] << 24;
+}
+
+//解析 fmt 块，WAVE_FORMAT_EXTENSIBLE 按子格式 GUID 的前两个字节判断是整数还是 float
+static bool parseFormat(WavDecoder *wav, const unsigned char *fmt, size_t bytes) {
+    if (bytes < 16) {
+        return false;
+    }
+    unsigned format = getLe16(fmt);
+    unsigned channels = getLe16(fmt + 2);
+    unsigned bits = getLe16(fmt + 14);
+    if (format == WAV_FORMAT_EXTENSIBLE) {
+        if (bytes < 26) {
+            return false;
+        }
+        format = getLe16(fmt + 24);
+    }
+    wav->floating = format == WAV_FORMAT_FLOAT;
+    if ((format != WAV_FORMAT_PCM && !wav->floating) || channels == 0 ||
+        (wav->floating && bits != 32) || (bits != 8 && bits != 16 && bits != 24 && bits != 32)) {
+        return false;
+    }
+    wav->base.channels = channels;
+    wav->base.sampleRate = getLe32(fmt + 4);
+    wav->bytesPerSample = bits / 8;
+    wav->blockAlign = channels * wav->bytesPerSample;
+    return wav->base.sampleRate != 0;
+}
+
+//与 mapped_wav.c 一样逐块扫描，data 块长度不可信时按文件实际剩余的长度算
+static bool parseWav(WavDecoder *wav, const unsigned char *data, size_t bytes) {
+    bool haveFormat = false;
+    size_t offset = 12;
+    while (offset + 8 <= bytes) {
+        const unsigned char *chunk = data + offset;
+        size_t chunkBytes = getLe32(chunk + 4);
+        size_t body = offset + 8;
+        if (memcmp(chunk, "fmt ", 4) == 0) {
+            if (body + chunkBytes > bytes || !parseFormat(wav, data + body, chunkBytes)) {
+                return false;
+            }
+            haveFormat = true;
+        } else if (memcmp(chunk, "data", 4) == 0) {
+            if (!haveFormat) {
+                return false;
+            }
+            if (chunkBytes == 0 || chunkBytes > bytes - body) {
+                chunkBytes = bytes - body;
+            }
+            wav->data = data + body;
+            wav->base.frames = chunkBytes / wav->blockAlign;
+            return wav->base.frames > 0;
+        }
+        //块按偶数字节对齐
+        offset = body + chunkBytes + (chunkBytes & 1);
+    }
+    return false;
+}
+
+//一个样本转换成 16 位精度的 int32，8 位 WAV 是无符号的
+static int32_t sampleAt(const WavDecoder *wav, const unsigned char *p) {
+    switch (wav->bytesPerSample) {
+        case 1:
+            return ((int32_t) p[0] - 128) * 256;
+        case 2:
+            return (int16_t) getLe16(p);
+        case 3:
+            return (int32_t) ((uint32_t) p[0] << 8 | (uint32_t) p[1] << 16 |
+                              (uint32_t) p[2] << 24) >> 16;
+        default:
+            return (int32_t) getLe32(p) >> 16;
+    }
+}
+
+static float floatAt(const unsigned char *p) {
+    uint32_t bits = getLe32(p);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+//一个样本转换成 int16
+static short sampleS16(const WavDecoder *wav, const unsigned char *p) {
+    if (wav->floating) {
+        long sample = lrintf(floatAt(p) * 32768.0f);
+        return (short) (sample > 32767 ? 32767 : sample < -32768 ? -32768 : sample);
+    }
+    return (short) sampleAt(wav, p);
+}
+
+static unsigned wavRead(AudioDecoder *decoder, short *dst, unsigned frames) {
+    WavDecoder *wav = (WavDecoder *) decoder;
+    unsigned channels = decoder->channels;
+    unsigned i, c;
+    if (frames > decoder->frames - wav->position) {
+        frames = (unsigned) (decoder->frames - wav->position);
+    }
+    const unsigned char *src = wav->data + wav->position * wav->blockAlign;
+    //最常见的 16 位单声道和立体声直接拷贝或平均。样本按主机字节序读取，与 mapped_wav.c 相同；
+    //资源在 APK 里不一定两字节对齐，所以用 memcpy 取样本
+    if (!wav->floating && wav->bytesPerSample == 2 && channels <= 2) {
+        if (channels == 1 || decoder->stereo) {
+            memcpy(dst, src, (size_t) frames * channels * sizeof(short));
+        } else {
+            for (i = 0; i < frames; ++i) {
+                short pair[2];
+                memcpy(pair, src + 4 * i, sizeof(pair));
+                dst[i] = (short) ((pair[0] + pair[1]) >> 1);
+            }
+        }
+        wav->position += frames;
+        return frames;
+    }
+    for (i = 0; i < frames; ++i) {
+        const unsigned char *frame = src + (size_t) i * wav->blockAlign;
+        if (decoder->stereo) {
+            dst[2 * i] = sampleS16(wav, frame);
+            dst[2 * i + 1] = sampleS16(wav, frame + wav->bytesPerSample);
+        } else if (wav->floating) {
+            float sum = 0.0f;
+            for (c = 0; c < channels; ++c) {
+                sum += floatAt(frame + c * 4);
+            }
+            long sample = lrintf(sum / channels * 32768.0f);
+            dst[i] = (short) (sample > 32767 ? 32767 : sample < -32768 ? -32768 : sample);
+        } else {
+            int32_t sum = 0;
+            for (c = 0; c < channels; ++c) {
+                sum += sampleAt(wav, frame + c * wav->bytesPerSample);
+            }
+            dst[i] = (short) (sum / (int32_t) channels);
+        }
+    }
+    wav->position += frames;
+    return frames;
+}
+
+static void wavClose(AudioDecoder *decoder) {
+    WavDecoder *wav = (WavDecoder *) decoder;
+    if (wav->mapping != NULL) {
+        munmap(wav->mapping, wav->mappingBytes);
+    }
+    free(wav);
+}
+
+static const AudioDecoderOps wavOps = {
+        "wav", wavRead, wavClose,
+};
+
+AudioDecoder *audioDecoderOpenWav(const AudioDecoderSource *source) {
+    unsigned char head[12];
+    if (source->fd < 0 || source->start < 0 || source->length < (off_t) sizeof(short)) {
+        return NULL;
+    }
+    //先只读文件头，不是 WAV 也不是裸 PCM 时不用映射整个文件
+    bool riff = source->length >= 12 && pread(source->fd, head, 12, source->start) == 12 &&
+                memcmp(head, "RIFF", 4) == 0 && memcmp(head + 8, "WAVE", 4) == 0;
+    if (!riff && source->rawSampleRate == 0) {
+        return NULL;
+    }
+    WavDecoder *wav = (WavDecoder *) calloc(1, sizeof(WavDecoder));
+    if (wav == NULL) {
+        return NULL;
+    }
+    //mmap 的偏移必须按页对齐，资源在 APK 里的位置不一定对齐
+    off_t page = (off_t) sysconf(_SC_PAGESIZE);
+    off_t slack = source->start % page;
+    size_t bytes = (size_t) (source->length + slack);
+    void *mapping = mmap(NULL, bytes, PROT_READ, MAP_PRIVATE, source->fd, source->start - slack);
+    if (mapping == MAP_FAILED) {
+        free(wav);
+        return NULL;
+    }
+    wav->mapping = mapping;
+    wav->mappingBytes = bytes;
+    wav->base.ops = &wavOps;
+    const unsigned char *data = (const unsigned char *) mapping + slack;
+    if (riff) {
+        if (!parseWav(wav, data, (size_t) source->length)) {
+            wavClose(&wav->base);
+            return NULL;
+        }
+    } else {
+        wav->data = data;
+        wav->bytesPerSample = 2;
+        wav->blockAlign = 2;
+        wav->base.channels = 1;
+        wav->base.sampleRate = source->rawSampleRate;
+        wav->base.frames = (uint64_t) source->length / 2;
+    }
+    //解码是顺序读取
+    posix_madvise(mapping, bytes, POSIX_MADV_SEQUENTIAL);
+    return &wav->base;
+}
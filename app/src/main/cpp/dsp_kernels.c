@@ -0,0 +1,839 @@
+#include "dsp_kernels.h"
+
+#include <math.h>
+#include <stddef.h>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define DSP_HAVE_NEON 1
+#include <arm_neon.h>
+#elif defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__))
+#define DSP_HAVE_SSE2 1
+#include <emmintrin.h>
+#if defined(__GNUC__)
+#define DSP_HAVE_AVX2 1
+#include <immintrin.h>
+#endif
+#endif
+
+#define S16_TO_F32 (1.0f / 32768.0f)
+#define F32_TO_S16 32768.0f
+
+//---------------------------------------------------------------- 标量参考实现
+
+static void s16ToF32Scalar(const short *src, float *dst, unsigned n) {
+    unsigned i;
+    for (i = 0; i < n; ++i) {
+        dst[i] = src[i] * S16_TO_F32;
+    }
+}
+
+static short saturateS16(float v) {
+    v *= F32_TO_S16;
+    if (v >= 32767.0f) {
+        return 32767;
+    }
+    if (v <= -32768.0f) {
+        return -32768;
+    }
+    return (short) lrintf(v);
+}
+
+static void f32ToS16Scalar(const float *src, short *dst, unsigned n) {
+    unsigned i;
+    for (i = 0; i < n; ++i) {
+        dst[i] = saturateS16(src[i]);
+    }
+}
+
+//TPDF 抖动：一次 xorshift32 得到 32 位，高低 16 位各是一个均匀分布，
+//两者之和按 DITHER_SCALE 缩放、减去 DITHER_OFFSET 后是 (-1, 1) LSB 的三角分布
+#define DITHER_SCALE (1.0f / 65536.0f)
+#define DITHER_OFFSET (65535.0f / 65536.0f)
+
+static float ditherTpdf(uint32_t *state) {
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return (float) ((x & 0xFFFF) + (x >> 16)) * DITHER_SCALE - DITHER_OFFSET;
+}
+
+static void f32ToS16DitherScalar(const float *src, short *dst, unsigned n, DspDither *dither) {
+    unsigned i;
+    for (i = 0; i < n; ++i) {
+        float v = src[i] * F32_TO_S16 + ditherTpdf(&dither->state[0]);
+        if (v >= 32767.0f) {
+            dst[i] = 32767;
+        } else if (v <= -32768.0f) {
+            dst[i] = -32768;
+        } else {
+            dst[i] = (short) lrintf(v);
+        }
+    }
+}
+
+static void gainScalar(float *buf, unsigned n, float gain) {
+    unsigned i;
+    for (i = 0; i < n; ++i) {
+        buf[i] *= gain;
+    }
+}
+
+static void gainRampScalar(float *buf, unsigned n, float start, float end) {
+    float step = n ? (end - start) / n : 0.0f;
+    unsigned i;
+    for (i = 0; i < n; ++i) {
+        buf[i] *= start + step * (i + 1);
+    }
+}
+
+static void panScalar(const float *src, float *dst, unsigned frames, float left, float right) {
+    unsigned i;
+    for (i = 0; i < frames; ++i) {
+        dst[2 * i] = src[i] * left;
+        dst[2 * i + 1] = src[i] * right;
+    }
+}
+
+static void mixScalar(float *dst, const float *src, unsigned n, float gain) {
+    unsigned i;
+    for (i = 0; i < n; ++i) {
+        dst[i] += src[i] * gain;
+    }
+}
+
+static void mixRampScalar(float *dst, const float *src, unsigned n, float start, float end) {
+    float step = n ? (end - start) / n : 0.0f;
+    unsigned i;
+    for (i = 0; i < n; ++i) {
+        dst[i] += src[i] * (start + step * (i + 1));
+    }
+}
+
+static void mixPanRampScalar(float *dst, const float *src, unsigned frames, float leftStart,
+                             float leftEnd, float rightStart, float rightEnd) {
+    float leftStep = frames ? (leftEnd - leftStart) / frames : 0.0f;
+    float rightStep = frames ? (rightEnd - rightStart) / frames : 0.0f;
+    unsigned i;
+    for (i = 0; i < frames; ++i) {
+        dst[2 * i] += src[i] * (leftStart + leftStep * (i + 1));
+        dst[2 * i + 1] += src[i] * (rightStart + rightStep * (i + 1));
+    }
+}
+
+static void interleaveScalar(const float *left, const float *right, float *dst,
+                             unsigned frames) {
+    unsigned i;
+    for (i = 0; i < frames; ++i) {
+        dst[2 * i] = left[i];
+        dst[2 * i + 1] = right[i];
+    }
+}
+
+static void deinterleaveScalar(const float *src, float *left, float *right, unsigned frames) {
+    unsigned i;
+    for (i = 0; i < frames; ++i) {
+        left[i] = src[2 * i];
+        right[i] = src[2 * i + 1];
+    }
+}
+
+static float dotProductScalar(const float *a, const float *b, unsigned n) {
+    float sum = 0.0f;
+    unsigned i;
+    for (i = 0; i < n; ++i) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+static const DspKernels scalarKernels = {
+        "scalar",
+        s16ToF32Scalar,
+        f32ToS16Scalar,
+        f32ToS16DitherScalar,
+        gainScalar,
+        gainRampScalar,
+        panScalar,
+        mixScalar,
+        mixRampScalar,
+        mixPanRampScalar,
+        interleaveScalar,
+        deinterleaveScalar,
+        dotProductScalar,
+};
+
+//SIMD 版本只处理 4/8 的整数倍，剩下的尾部交给标量实现
+
+//---------------------------------------------------------------- NEON
+
+#if DSP_HAVE_NEON
+
+static void s16ToF32Neon(const short *src, float *dst, unsigned n) {
+    unsigned i = 0;
+    float32x4_t scale = vdupq_n_f32(S16_TO_F32);
+    for (; i + 8 <= n; i += 8) {
+        int16x8_t s = vld1q_s16(src + i);
+        vst1q_f32(dst + i, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(s))), scale));
+        vst1q_f32(dst + i + 4, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(s))), scale));
+    }
+    s16ToF32Scalar(src + i, dst + i, n - i);
+}
+
+static int32x4_t roundToS32Neon(float32x4_t v) {
+#if defined(__aarch64__)
+    return vcvtnq_s32_f32(v);
+#else
+    //ARMv7 只有向零取整，先按符号加减 0.5
+    uint32x4_t negative = vcltq_f32(v, vdupq_n_f32(0.0f));
+    float32x4_t half = vbslq_f32(negative, vdupq_n_f32(-0.5f), vdupq_n_f32(0.5f));
+    return vcvtq_s32_f32(vaddq_f32(v, half));
+#endif
+}
+
+static void f32ToS16Neon(const float *src, short *dst, unsigned n) {
+    unsigned i = 0;
+    float32x4_t scale = vdupq_n_f32(F32_TO_S16);
+    float32x4_t lo = vdupq_n_f32(-32768.0f), hi = vdupq_n_f32(32767.0f);
+    for (; i + 8 <= n; i += 8) {
+        float32x4_t a = vminq_f32(vmaxq_f32(vmulq_f32(vld1q_f32(src + i), scale), lo), hi);
+        float32x4_t b = vminq_f32(vmaxq_f32(vmulq_f32(vld1q_f32(src + i + 4), scale), lo), hi);
+        vst1q_s16(dst + i, vcombine_s16(vqmovn_s32(roundToS32Neon(a)),
+                                        vqmovn_s32(roundToS32Neon(b))));
+    }
+    f32ToS16Scalar(src + i, dst + i, n - i);
+}
+
+//返回未缩放的两个 16 位均匀分布之和，缩放和偏移与样本的缩放合并进一次乘加
+static uint32x4_t ditherSumNeon(uint32x4_t *state) {
+    uint32x4_t x = *state;
+    x = veorq_u32(x, vshlq_n_u32(x, 13));
+    x = veorq_u32(x, vshrq_n_u32(x, 17));
+    x = veorq_u32(x, vshlq_n_u32(x, 5));
+    *state = x;
+    return vaddq_u32(vandq_u32(x, vdupq_n_u32(0xFFFF)), vshrq_n_u32(x, 16));
+}
+
+static void f32ToS16DitherNeon(const float *src, short *dst, unsigned n, DspDither *dither) {
+    unsigned i = 0;
+    float32x4_t scale = vdupq_n_f32(F32_TO_S16);
+    float32x4_t ditherScale = vdupq_n_f32(DITHER_SCALE), offset = vdupq_n_f32(-DITHER_OFFSET);
+    float32x4_t lo = vdupq_n_f32(-32768.0f), hi = vdupq_n_f32(32767.0f);
+    uint32x4_t s0 = vld1q_u32(dither->state), s1 = vld1q_u32(dither->state + 4);
+    for (; i + 8 <= n; i += 8) {
+        float32x4_t a = vmlaq_f32(offset, vcvtq_f32_u32(ditherSumNeon(&s0)), ditherScale);
+        float32x4_t b = vmlaq_f32(offset, vcvtq_f32_u32(ditherSumNeon(&s1)), ditherScale);
+        a = vmlaq_f32(a, vld1q_f32(src + i), scale);
+        b = vmlaq_f32(b, vld1q_f32(src + i + 4), scale);
+        a = vminq_f32(vmaxq_f32(a, lo), hi);
+        b = vminq_f32(vmaxq_f32(b, lo), hi);
+        vst1q_s16(dst + i, vcombine_s16(vqmovn_s32(roundToS32Neon(a)),
+                                        vqmovn_s32(roundToS32Neon(b))));
+    }
+    vst1q_u32(dither->state, s0);
+    vst1q_u32(dither->state + 4, s1);
+    f32ToS16DitherScalar(src + i, dst + i, n - i, dither);
+}
+
+static void gainNeon(float *buf, unsigned n, float gain) {
+    unsigned i = 0;
+    float32x4_t g = vdupq_n_f32(gain);
+    for (; i + 4 <= n; i += 4) {
+        vst1q_f32(buf + i, vmulq_f32(vld1q_f32(buf + i), g));
+    }
+    gainScalar(buf + i, n - i, gain);
+}
+
+static void gainRampNeon(float *buf, unsigned n, float start, float end) {
+    float step = n ? (end - start) / n : 0.0f;
+    unsigned i = 0;
+    float init[4] = {start + step, start + 2 * step, start + 3 * step, start + 4 * step};
+    float32x4_t g = vld1q_f32(init);
+    float32x4_t inc = vdupq_n_f32(4 * step);
+    for (; i + 4 <= n; i += 4) {
+        vst1q_f32(buf + i, vmulq_f32(vld1q_f32(buf + i), g));
+        g = vaddq_f32(g, inc);
+    }
+    for (; i < n; ++i) {
+        buf[i] *= start + step * (i + 1);
+    }
+}
+
+static void panNeon(const float *src, float *dst, unsigned frames, float left, float right) {
+    unsigned i = 0;
+    float32x4_t l = vdupq_n_f32(left), r = vdupq_n_f32(right);
+    for (; i + 4 <= frames; i += 4) {
+        float32x4_t s = vld1q_f32(src + i);
+        float32x4x2_t out = {{vmulq_f32(s, l), vmulq_f32(s, r)}};
+        vst2q_f32(dst + 2 * i, out);
+    }
+    panScalar(src + i, dst + 2 * i, frames - i, left, right);
+}
+
+static void mixNeon(float *dst, const float *src, unsigned n, float gain) {
+    unsigned i = 0;
+    float32x4_t g = vdupq_n_f32(gain);
+    for (; i + 4 <= n; i += 4) {
+        vst1q_f32(dst + i, vmlaq_f32(vld1q_f32(dst + i), vld1q_f32(src + i), g));
+    }
+    mixScalar(dst + i, src + i, n - i, gain);
+}
+
+static void mixRampNeon(float *dst, const float *src, unsigned n, float start, float end) {
+    float step = n ? (end - start) / n : 0.0f;
+    unsigned i = 0;
+    float init[4] = {start + step, start + 2 * step, start + 3 * step, start + 4 * step};
+    float32x4_t g = vld1q_f32(init);
+    float32x4_t inc = vdupq_n_f32(4 * step);
+    for (; i + 4 <= n; i += 4) {
+        vst1q_f32(dst + i, vmlaq_f32(vld1q_f32(dst + i), vld1q_f32(src + i), g));
+        g = vaddq_f32(g, inc);
+    }
+    for (; i < n; ++i) {
+        dst[i] += src[i] * (start + step * (i + 1));
+    }
+}
+
+static void mixPanRampNeon(float *dst, const float *src, unsigned frames, float leftStart,
+                           float leftEnd, float rightStart, float rightEnd) {
+    float leftStep = frames ? (leftEnd - leftStart) / frames : 0.0f;
+    float rightStep = frames ? (rightEnd - rightStart) / frames : 0.0f;
+    unsigned i = 0;
+    float initLeft[4] = {leftStart + leftStep, leftStart + 2 * leftStep,
+                         leftStart + 3 * leftStep, leftStart + 4 * leftStep};
+    float initRight[4] = {rightStart + rightStep, rightStart + 2 * rightStep,
+                          rightStart + 3 * rightStep, rightStart + 4 * rightStep};
+    float32x4_t l = vld1q_f32(initLeft), r = vld1q_f32(initRight);
+    float32x4_t incLeft = vdupq_n_f32(4 * leftStep), incRight = vdupq_n_f32(4 * rightStep);
+    for (; i + 4 <= frames; i += 4) {
+        float32x4_t s = vld1q_f32(src + i);
+        float32x4x2_t out = vld2q_f32(dst + 2 * i);
+        out.val[0] = vmlaq_f32(out.val[0], s, l);
+        out.val[1] = vmlaq_f32(out.val[1], s, r);
+        vst2q_f32(dst + 2 * i, out);
+        l = vaddq_f32(l, incLeft);
+        r = vaddq_f32(r, incRight);
+    }
+    for (; i < frames; ++i) {
+        dst[2 * i] += src[i] * (leftStart + leftStep * (i + 1));
+        dst[2 * i + 1] += src[i] * (rightStart + rightStep * (i + 1));
+    }
+}
+
+static void interleaveNeon(const float *left, const float *right, float *dst, unsigned frames) {
+    unsigned i = 0;
+    for (; i + 4 <= frames; i += 4) {
+        float32x4x2_t out = {{vld1q_f32(left + i), vld1q_f32(right + i)}};
+        vst2q_f32(dst + 2 * i, out);
+    }
+    interleaveScalar(left + i, right + i, dst + 2 * i, frames - i);
+}
+
+static void deinterleaveNeon(const float *src, float *left, float *right, unsigned frames) {
+    unsigned i = 0;
+    for (; i + 4 <= frames; i += 4) {
+        float32x4x2_t in = vld2q_f32(src + 2 * i);
+        vst1q_f32(left + i, in.val[0]);
+        vst1q_f32(right + i, in.val[1]);
+    }
+    deinterleaveScalar(src + 2 * i, left + i, right + i, frames - i);
+}
+
+static float dotProductNeon(const float *a, const float *b, unsigned n) {
+    unsigned i = 0;
+    float32x4_t acc = vdupq_n_f32(0.0f);
+    for (; i + 4 <= n; i += 4) {
+        acc = vmlaq_f32(acc, vld1q_f32(a + i), vld1q_f32(b + i));
+    }
+    float32x2_t s = vadd_f32(vget_low_f32(acc), vget_high_f32(acc));
+    return vget_lane_f32(vpadd_f32(s, s), 0) + dotProductScalar(a + i, b + i, n - i);
+}
+
+static const DspKernels neonKernels = {
+        "neon",
+        s16ToF32Neon,
+        f32ToS16Neon,
+        f32ToS16DitherNeon,
+        gainNeon,
+        gainRampNeon,
+        panNeon,
+        mixNeon,
+        mixRampNeon,
+        mixPanRampNeon,
+        interleaveNeon,
+        deinterleaveNeon,
+        dotProductNeon,
+};
+
+#endif
+
+//---------------------------------------------------------------- SSE2
+
+#if DSP_HAVE_SSE2
+
+static void s16ToF32Sse2(const short *src, float *dst, unsigned n) {
+    unsigned i = 0;
+    __m128 scale = _mm_set1_ps(S16_TO_F32);
+    for (; i + 8 <= n; i += 8) {
+        __m128i s = _mm_loadu_si128((const __m128i *) (src + i));
+        //把 16 位放到高半部分再算术右移，完成符号扩展
+        __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16);
+        __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(s, s), 16);
+        _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+        _mm_storeu_ps(dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+    }
+    s16ToF32Scalar(src + i, dst + i, n - i);
+}
+
+static void f32ToS16Sse2(const float *src, short *dst, unsigned n) {
+    unsigned i = 0;
+    __m128 scale = _mm_set1_ps(F32_TO_S16);
+    __m128 lo = _mm_set1_ps(-32768.0f), hi = _mm_set1_ps(32767.0f);
+    for (; i + 8 <= n; i += 8) {
+        __m128 a = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src + i), scale), lo), hi);
+        __m128 b = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src + i + 4), scale), lo), hi);
+        _mm_storeu_si128((__m128i *) (dst + i),
+                         _mm_packs_epi32(_mm_cvtps_epi32(a), _mm_cvtps_epi32(b)));
+    }
+    f32ToS16Scalar(src + i, dst + i, n - i);
+}
+
+//返回未缩放的两个 16 位均匀分布之和，最大 131070，转成 float 不会溢出
+static __m128i ditherSumSse2(__m128i *state) {
+    __m128i x = *state;
+    x = _mm_xor_si128(x, _mm_slli_epi32(x, 13));
+    x = _mm_xor_si128(x, _mm_srli_epi32(x, 17));
+    x = _mm_xor_si128(x, _mm_slli_epi32(x, 5));
+    *state = x;
+    return _mm_add_epi32(_mm_and_si128(x, _mm_set1_epi32(0xFFFF)), _mm_srli_epi32(x, 16));
+}
+
+static void f32ToS16DitherSse2(const float *src, short *dst, unsigned n, DspDither *dither) {
+    unsigned i = 0;
+    __m128 scale = _mm_set1_ps(F32_TO_S16);
+    __m128 ditherScale = _mm_set1_ps(DITHER_SCALE), offset = _mm_set1_ps(DITHER_OFFSET);
+    __m128 lo = _mm_set1_ps(-32768.0f), hi = _mm_set1_ps(32767.0f);
+    __m128i s0 = _mm_loadu_si128((const __m128i *) dither->state);
+    __m128i s1 = _mm_loadu_si128((const __m128i *) (dither->state + 4));
+    for (; i + 8 <= n; i += 8) {
+        __m128 da = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(ditherSumSse2(&s0)), ditherScale), offset);
+        __m128 db = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(ditherSumSse2(&s1)), ditherScale), offset);
+        __m128 a = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src + i), scale), da);
+        __m128 b = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src + i + 4), scale), db);
+        a = _mm_min_ps(_mm_max_ps(a, lo), hi);
+        b = _mm_min_ps(_mm_max_ps(b, lo), hi);
+        _mm_storeu_si128((__m128i *) (dst + i),
+                         _mm_packs_epi32(_mm_cvtps_epi32(a), _mm_cvtps_epi32(b)));
+    }
+    _mm_storeu_si128((__m128i *) dither->state, s0);
+    _mm_storeu_si128((__m128i *) (dither->state + 4), s1);
+    f32ToS16DitherScalar(src + i, dst + i, n - i, dither);
+}
+
+static void gainSse2(float *buf, unsigned n, float gain) {
+    unsigned i = 0;
+    __m128 g = _mm_set1_ps(gain);
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(buf + i, _mm_mul_ps(_mm_loadu_ps(buf + i), g));
+    }
+    gainScalar(buf + i, n - i, gain);
+}
+
+static void gainRampSse2(float *buf, unsigned n, float start, float end) {
+    float step = n ? (end - start) / n : 0.0f;
+    unsigned i = 0;
+    __m128 g = _mm_setr_ps(start + step, start + 2 * step, start + 3 * step, start + 4 * step);
+    __m128 inc = _mm_set1_ps(4 * step);
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(buf + i, _mm_mul_ps(_mm_loadu_ps(buf + i), g));
+        g = _mm_add_ps(g, inc);
+    }
+    for (; i < n; ++i) {
+        buf[i] *= start + step * (i + 1);
+    }
+}
+
+static void panSse2(const float *src, float *dst, unsigned frames, float left, float right) {
+    unsigned i = 0;
+    __m128 lr = _mm_setr_ps(left, right, left, right);
+    for (; i + 4 <= frames; i += 4) {
+        __m128 s = _mm_loadu_ps(src + i);
+        _mm_storeu_ps(dst + 2 * i, _mm_mul_ps(_mm_unpacklo_ps(s, s), lr));
+        _mm_storeu_ps(dst + 2 * i + 4, _mm_mul_ps(_mm_unpackhi_ps(s, s), lr));
+    }
+    panScalar(src + i, dst + 2 * i, frames - i, left, right);
+}
+
+static void mixSse2(float *dst, const float *src, unsigned n, float gain) {
+    unsigned i = 0;
+    __m128 g = _mm_set1_ps(gain);
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i),
+                                          _mm_mul_ps(_mm_loadu_ps(src + i), g)));
+    }
+    mixScalar(dst + i, src + i, n - i, gain);
+}
+
+static void mixRampSse2(float *dst, const float *src, unsigned n, float start, float end) {
+    float step = n ? (end - start) / n : 0.0f;
+    unsigned i = 0;
+    __m128 g = _mm_setr_ps(start + step, start + 2 * step, start + 3 * step, start + 4 * step);
+    __m128 inc = _mm_set1_ps(4 * step);
+    for (; i + 4 <= n; i += 4) {
+        __m128 d = _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), g));
+        _mm_storeu_ps(dst + i, d);
+        g = _mm_add_ps(g, inc);
+    }
+    for (; i < n; ++i) {
+        dst[i] += src[i] * (start + step * (i + 1));
+    }
+}
+
+static void mixPanRampSse2(float *dst, const float *src, unsigned frames, float leftStart,
+                           float leftEnd, float rightStart, float rightEnd) {
+    float leftStep = frames ? (leftEnd - leftStart) / frames : 0.0f;
+    float rightStep = frames ? (rightEnd - rightStart) / frames : 0.0f;
+    unsigned i = 0;
+    //lo 是第 1、2 帧的 (左, 右) 增益，hi 是第 3、4 帧的
+    __m128 lo = _mm_setr_ps(leftStart + leftStep, rightStart + rightStep,
+                            leftStart + 2 * leftStep, rightStart + 2 * rightStep);
+    __m128 inc = _mm_setr_ps(2 * leftStep, 2 * rightStep, 2 * leftStep, 2 * rightStep);
+    __m128 hi = _mm_add_ps(lo, inc);
+    inc = _mm_add_ps(inc, inc);
+    for (; i + 4 <= frames; i += 4) {
+        __m128 s = _mm_loadu_ps(src + i);
+        __m128 a = _mm_add_ps(_mm_loadu_ps(dst + 2 * i), _mm_mul_ps(_mm_unpacklo_ps(s, s), lo));
+        __m128 b = _mm_add_ps(_mm_loadu_ps(dst + 2 * i + 4), _mm_mul_ps(_mm_unpackhi_ps(s, s), hi));
+        _mm_storeu_ps(dst + 2 * i, a);
+        _mm_storeu_ps(dst + 2 * i + 4, b);
+        lo = _mm_add_ps(lo, inc);
+        hi = _mm_add_ps(hi, inc);
+    }
+    for (; i < frames; ++i) {
+        dst[2 * i] += src[i] * (leftStart + leftStep * (i + 1));
+        dst[2 * i + 1] += src[i] * (rightStart + rightStep * (i + 1));
+    }
+}
+
+static void interleaveSse2(const float *left, const float *right, float *dst, unsigned frames) {
+    unsigned i = 0;
+    for (; i + 4 <= frames; i += 4) {
+        __m128 l = _mm_loadu_ps(left + i), r = _mm_loadu_ps(right + i);
+        _mm_storeu_ps(dst + 2 * i, _mm_unpacklo_ps(l, r));
+        _mm_storeu_ps(dst + 2 * i + 4, _mm_unpackhi_ps(l, r));
+    }
+    interleaveScalar(left + i, right + i, dst + 2 * i, frames - i);
+}
+
+static void deinterleaveSse2(const float *src, float *left, float *right, unsigned frames) {
+    unsigned i = 0;
+    for (; i + 4 <= frames; i += 4) {
+        __m128 a = _mm_loadu_ps(src + 2 * i), b = _mm_loadu_ps(src + 2 * i + 4);
+        _mm_storeu_ps(left + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(right + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+    deinterleaveScalar(src + 2 * i, left + i, right + i, frames - i);
+}
+
+static float horizontalSumSse2(__m128 v) {
+    __m128 shuf = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+    __m128 sums = _mm_add_ps(v, shuf);
+    shuf = _mm_movehl_ps(shuf, sums);
+    return _mm_cvtss_f32(_mm_add_ss(sums, shuf));
+}
+
+static float dotProductSse2(const float *a, const float *b, unsigned n) {
+    unsigned i = 0;
+    __m128 acc = _mm_setzero_ps();
+    for (; i + 4 <= n; i += 4) {
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    }
+    return horizontalSumSse2(acc) + dotProductScalar(a + i, b + i, n - i);
+}
+
+static const DspKernels sse2Kernels = {
+        "sse2",
+        s16ToF32Sse2,
+        f32ToS16Sse2,
+        f32ToS16DitherSse2,
+        gainSse2,
+        gainRampSse2,
+        panSse2,
+        mixSse2,
+        mixRampSse2,
+        mixPanRampSse2,
+        interleaveSse2,
+        deinterleaveSse2,
+        dotProductSse2,
+};
+
+#endif
+
+//---------------------------------------------------------------- AVX2
+
+#if DSP_HAVE_AVX2
+
+#define AVX2 __attribute__((target("avx2,fma")))
+
+AVX2 static void s16ToF32Avx2(const short *src, float *dst, unsigned n) {
+    unsigned i = 0;
+    __m256 scale = _mm256_set1_ps(S16_TO_F32);
+    for (; i + 16 <= n; i += 16) {
+        __m128i a = _mm_loadu_si128((const __m128i *) (src + i));
+        __m128i b = _mm_loadu_si128((const __m128i *) (src + i + 8));
+        _mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(a)), scale));
+        _mm256_storeu_ps(dst + i + 8,
+                         _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(b)), scale));
+    }
+    s16ToF32Scalar(src + i, dst + i, n - i);
+}
+
+AVX2 static void f32ToS16Avx2(const float *src, short *dst, unsigned n) {
+    unsigned i = 0;
+    __m256 scale = _mm256_set1_ps(F32_TO_S16);
+    __m256 lo = _mm256_set1_ps(-32768.0f), hi = _mm256_set1_ps(32767.0f);
+    for (; i + 16 <= n; i += 16) {
+        __m256 a = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(src + i), scale), lo), hi);
+        __m256 b = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(src + i + 8), scale), lo),
+                                 hi);
+        //packs 在每个 128 位通道内交错，之后用 permute 恢复顺序
+        __m256i packed = _mm256_packs_epi32(_mm256_cvtps_epi32(a), _mm256_cvtps_epi32(b));
+        _mm256_storeu_si256((__m256i *) (dst + i), _mm256_permute4x64_epi64(packed, 0xD8));
+    }
+    f32ToS16Scalar(src + i, dst + i, n - i);
+}
+
+AVX2 static __m256i ditherSumAvx2(__m256i *state) {
+    __m256i x = *state;
+    x = _mm256_xor_si256(x, _mm256_slli_epi32(x, 13));
+    x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 17));
+    x = _mm256_xor_si256(x, _mm256_slli_epi32(x, 5));
+    *state = x;
+    return _mm256_add_epi32(_mm256_and_si256(x, _mm256_set1_epi32(0xFFFF)),
+                            _mm256_srli_epi32(x, 16));
+}
+
+AVX2 static void f32ToS16DitherAvx2(const float *src, short *dst, unsigned n, DspDither *dither) {
+    unsigned i = 0;
+    __m256 scale = _mm256_set1_ps(F32_TO_S16);
+    __m256 ditherScale = _mm256_set1_ps(DITHER_SCALE), offset = _mm256_set1_ps(DITHER_OFFSET);
+    __m256 lo = _mm256_set1_ps(-32768.0f), hi = _mm256_set1_ps(32767.0f);
+    __m256i s0 = _mm256_loadu_si256((const __m256i *) dither->state);
+    __m256i s1 = _mm256_loadu_si256((const __m256i *) (dither->state + 8));
+    for (; i + 16 <= n; i += 16) {
+        __m256 da = _mm256_fmsub_ps(_mm256_cvtepi32_ps(ditherSumAvx2(&s0)), ditherScale, offset);
+        __m256 db = _mm256_fmsub_ps(_mm256_cvtepi32_ps(ditherSumAvx2(&s1)), ditherScale, offset);
+        __m256 a = _mm256_fmadd_ps(_mm256_loadu_ps(src + i), scale, da);
+        __m256 b = _mm256_fmadd_ps(_mm256_loadu_ps(src + i + 8), scale, db);
+        a = _mm256_min_ps(_mm256_max_ps(a, lo), hi);
+        b = _mm256_min_ps(_mm256_max_ps(b, lo), hi);
+        __m256i packed = _mm256_packs_epi32(_mm256_cvtps_epi32(a), _mm256_cvtps_epi32(b));
+        _mm256_storeu_si256((__m256i *) (dst + i), _mm256_permute4x64_epi64(packed, 0xD8));
+    }
+    _mm256_storeu_si256((__m256i *) dither->state, s0);
+    _mm256_storeu_si256((__m256i *) (dither->state + 8), s1);
+    f32ToS16DitherScalar(src + i, dst + i, n - i, dither);
+}
+
+AVX2 static void gainAvx2(float *buf, unsigned n, float gain) {
+    unsigned i = 0;
+    __m256 g = _mm256_set1_ps(gain);
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(buf + i, _mm256_mul_ps(_mm256_loadu_ps(buf + i), g));
+    }
+    gainScalar(buf + i, n - i, gain);
+}
+
+AVX2 static void gainRampAvx2(float *buf, unsigned n, float start, float end) {
+    float step = n ? (end - start) / n : 0.0f;
+    unsigned i = 0;
+    __m256 g = _mm256_add_ps(_mm256_set1_ps(start),
+                             _mm256_mul_ps(_mm256_setr_ps(1, 2, 3, 4, 5, 6, 7, 8),
+                                           _mm256_set1_ps(step)));
+    __m256 inc = _mm256_set1_ps(8 * step);
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(buf + i, _mm256_mul_ps(_mm256_loadu_ps(buf + i), g));
+        g = _mm256_add_ps(g, inc);
+    }
+    for (; i < n; ++i) {
+        buf[i] *= start + step * (i + 1);
+    }
+}
+
+AVX2 static void panAvx2(const float *src, float *dst, unsigned frames, float left, float right) {
+    unsigned i = 0;
+    __m256 lr = _mm256_setr_ps(left, right, left, right, left, right, left, right);
+    for (; i + 8 <= frames; i += 8) {
+        __m256 s = _mm256_loadu_ps(src + i);
+        __m256 lo = _mm256_unpacklo_ps(s, s);
+        __m256 hi = _mm256_unpackhi_ps(s, s);
+        _mm256_storeu_ps(dst + 2 * i, _mm256_mul_ps(_mm256_permute2f128_ps(lo, hi, 0x20), lr));
+        _mm256_storeu_ps(dst + 2 * i + 8, _mm256_mul_ps(_mm256_permute2f128_ps(lo, hi, 0x31), lr));
+    }
+    panScalar(src + i, dst + 2 * i, frames - i, left, right);
+}
+
+AVX2 static void mixAvx2(float *dst, const float *src, unsigned n, float gain) {
+    unsigned i = 0;
+    __m256 g = _mm256_set1_ps(gain);
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(dst + i, _mm256_fmadd_ps(_mm256_loadu_ps(src + i), g,
+                                                  _mm256_loadu_ps(dst + i)));
+    }
+    mixScalar(dst + i, src + i, n - i, gain);
+}
+
+AVX2 static void mixRampAvx2(float *dst, const float *src, unsigned n, float start, float end) {
+    float step = n ? (end - start) / n : 0.0f;
+    unsigned i = 0;
+    __m256 g = _mm256_add_ps(_mm256_set1_ps(start),
+                             _mm256_mul_ps(_mm256_setr_ps(1, 2, 3, 4, 5, 6, 7, 8),
+                                           _mm256_set1_ps(step)));
+    __m256 inc = _mm256_set1_ps(8 * step);
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(dst + i, _mm256_fmadd_ps(_mm256_loadu_ps(src + i), g,
+                                                  _mm256_loadu_ps(dst + i)));
+        g = _mm256_add_ps(g, inc);
+    }
+    for (; i < n; ++i) {
+        dst[i] += src[i] * (start + step * (i + 1));
+    }
+}
+
+AVX2 static void mixPanRampAvx2(float *dst, const float *src, unsigned frames, float leftStart,
+                                float leftEnd, float rightStart, float rightEnd) {
+    float leftStep = frames ? (leftEnd - leftStart) / frames : 0.0f;
+    float rightStep = frames ? (rightEnd - rightStart) / frames : 0.0f;
+    unsigned i = 0;
+    //lo 是第 1~4 帧的 (左, 右) 增益，hi 是第 5~8 帧的
+    __m256 frame = _mm256_setr_ps(1, 1, 2, 2, 3, 3, 4, 4);
+    __m256 step = _mm256_setr_ps(leftStep, rightStep, leftStep, rightStep,
+                                 leftStep, rightStep, leftStep, rightStep);
+    __m256 start = _mm256_setr_ps(leftStart, rightStart, leftStart, rightStart,
+                                  leftStart, rightStart, leftStart, rightStart);
+    __m256 lo = _mm256_fmadd_ps(frame, step, start);
+    __m256 hi = _mm256_fmadd_ps(_mm256_set1_ps(4), step, lo);
+    __m256 inc = _mm256_mul_ps(_mm256_set1_ps(8), step);
+    for (; i + 8 <= frames; i += 8) {
+        __m256 s = _mm256_loadu_ps(src + i);
+        __m256 a = _mm256_unpacklo_ps(s, s);
+        __m256 b = _mm256_unpackhi_ps(s, s);
+        _mm256_storeu_ps(dst + 2 * i, _mm256_fmadd_ps(_mm256_permute2f128_ps(a, b, 0x20), lo,
+                                                      _mm256_loadu_ps(dst + 2 * i)));
+        _mm256_storeu_ps(dst + 2 * i + 8, _mm256_fmadd_ps(_mm256_permute2f128_ps(a, b, 0x31), hi,
+                                                          _mm256_loadu_ps(dst + 2 * i + 8)));
+        lo = _mm256_add_ps(lo, inc);
+        hi = _mm256_add_ps(hi, inc);
+    }
+    for (; i < frames; ++i) {
+        dst[2 * i] += src[i] * (leftStart + leftStep * (i + 1));
+        dst[2 * i + 1] += src[i] * (rightStart + rightStep * (i + 1));
+    }
+}
+
+AVX2 static void interleaveAvx2(const float *left, const float *right, float *dst,
+                                unsigned frames) {
+    unsigned i = 0;
+    for (; i + 8 <= frames; i += 8) {
+        __m256 l = _mm256_loadu_ps(left + i), r = _mm256_loadu_ps(right + i);
+        __m256 lo = _mm256_unpacklo_ps(l, r);
+        __m256 hi = _mm256_unpackhi_ps(l, r);
+        _mm256_storeu_ps(dst + 2 * i, _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_storeu_ps(dst + 2 * i + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+    }
+    interleaveScalar(left + i, right + i, dst + 2 * i, frames - i);
+}
+
+AVX2 static void deinterleaveAvx2(const float *src, float *left, float *right, unsigned frames) {
+    unsigned i = 0;
+    for (; i + 8 <= frames; i += 8) {
+        __m256 a = _mm256_loadu_ps(src + 2 * i), b = _mm256_loadu_ps(src + 2 * i + 8);
+        __m256 lo = _mm256_permute2f128_ps(a, b, 0x20);
+        __m256 hi = _mm256_permute2f128_ps(a, b, 0x31);
+        _mm256_storeu_ps(left + i, _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm256_storeu_ps(right + i, _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+    deinterleaveScalar(src + 2 * i, left + i, right + i, frames - i);
+}
+
+AVX2 static float dotProductAvx2(const float *a, const float *b, unsigned n) {
+    unsigned i = 0;
+    __m256 acc = _mm256_setzero_ps();
+    for (; i + 8 <= n; i += 8) {
+        acc = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), acc);
+    }
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+    __m128 shuf = _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(2, 3, 0, 1));
+    sum = _mm_add_ps(sum, shuf);
+    sum = _mm_add_ss(sum, _mm_movehl_ps(shuf, sum));
+    return _mm_cvtss_f32(sum) + dotProductScalar(a + i, b + i, n - i);
+}
+
+static const DspKernels avx2Kernels = {
+        "avx2",
+        s16ToF32Avx2,
+        f32ToS16Avx2,
+        f32ToS16DitherAvx2,
+        gainAvx2,
+        gainRampAvx2,
+        panAvx2,
+        mixAvx2,
+        mixRampAvx2,
+        mixPanRampAvx2,
+        interleaveAvx2,
+        deinterleaveAvx2,
+        dotProductAvx2,
+};
+
+static int hasAvx2(void) {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+}
+
+#endif
+
+//----------------------------------------------------------------
+
+const DspKernels *dsp = &scalarKernels;
+
+void dspDitherInit(DspDither *dither, uint32_t seed) {
+    unsigned i;
+    for (i = 0; i < DSP_DITHER_LANES; ++i) {
+        //每个通道取不同的起点，避免几个通道输出同样的噪声
+        seed = seed * 1664525u + 1013904223u;
+        dither->state[i] = seed != 0 ? seed : 0x9E3779B9u;
+    }
+}
+
+const DspKernels *dspKernels(DspIsa isa) {
+    switch (isa) {
+        case DSP_ISA_SCALAR:
+            return &scalarKernels;
+#if DSP_HAVE_NEON
+        case DSP_ISA_NEON:
+            return &neonKernels;
+#endif
+#if DSP_HAVE_SSE2
+        case DSP_ISA_SSE2:
+            return &sse2Kernels;
+#endif
+#if DSP_HAVE_AVX2
+        case DSP_ISA_AVX2:
+            return hasAvx2() ? &avx2Kernels : NULL;
+#endif
+        default:
+            return NULL;
+    }
+}
+
+void dspInit(void) {
+    int isa;
+    for (isa = DSP_ISA_COUNT - 1; isa >= DSP_ISA_SCALAR; --isa) {
+        const DspKernels *kernels = dspKernels((DspIsa) isa);
+        if (kernels != NULL) {
+            dsp = kernels;
+            return;
+        }
+    }
+}
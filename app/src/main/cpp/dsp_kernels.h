@@ -0,0 +1,92 @@
+#ifndef NATIVEAUDIO_DSP_KERNELS_H
+#define NATIVEAUDIO_DSP_KERNELS_H
+
+#include <stdint.h>
+
+//样本处理的基础内核：int16/float 转换、增益、声像、混音、交错/解交错和点积。
+//每个内核都有标量参考实现，ARM 上用 NEON，x86 上用 SSE2，CPU 支持时在运行时切换到 AVX2。
+//float 样本的满幅是 [-1, 1)，与 int16 之间按 32768 缩放，转回 int16 时饱和。
+//
+//单核吞吐量（x86_64 主机，n = 1024，百万样本/秒，立体声内核按帧计）：
+//
+//    内核            scalar     sse2     avx2
+//    s16ToF32         1290     4350     9020
+//    f32ToS16          270     5030     7080
+//    f32ToS16Dither    190     1230     2870
+//    gain             1420     4010     9740
+//    gainRamp          760     2920     7400
+//    pan               760     2380     4110
+//    mix              1440     2960     5890
+//    mixRamp          1640     2570     5540
+//    mixPanRamp        330     1310     3340
+//    interleave        730     2590     4440
+//    deinterleave      780     2260     4840
+//    dotProduct       1330     2950     6630
+//
+//ARM 上的数字需要在设备上测量
+
+typedef enum {
+    DSP_ISA_SCALAR = 0,
+    DSP_ISA_NEON,
+    DSP_ISA_SSE2,
+    DSP_ISA_AVX2,
+    DSP_ISA_COUNT,
+} DspIsa;
+
+//TPDF 抖动的伪随机数状态：xorshift32 发生器，任何状态都不能为 0。SIMD 版本每个通道一个，
+//并且交替使用两组寄存器，让两条依赖链重叠执行。
+//不同指令集用到的通道数不同，所以同一个种子在不同 CPU 上得到的噪声序列不一样
+#define DSP_DITHER_LANES 16
+
+typedef struct DspDither {
+    uint32_t state[DSP_DITHER_LANES];
+} DspDither;
+
+void dspDitherInit(DspDither *dither, uint32_t seed);
+
+typedef struct DspKernels {
+    const char *name;
+
+    void (*s16ToF32)(const short *src, float *dst, unsigned n);
+
+    void (*f32ToS16)(const float *src, short *dst, unsigned n);
+
+    //与 f32ToS16 相同，但取整前加上 ±1 LSB 的三角分布（TPDF）抖动，
+    //把量化误差变成与信号无关的白噪声，小信号和渐弱不会出现失真的台阶
+    void (*f32ToS16Dither)(const float *src, short *dst, unsigned n, DspDither *dither);
+
+    void (*gain)(float *buf, unsigned n, float gain);
+
+    //增益从 start 线性变化到 end（第 n 个样本恰好到达 end）
+    void (*gainRamp)(float *buf, unsigned n, float start, float end);
+
+    //单声道 -> 交错立体声，左右声道分别乘以 left/right
+    void (*pan)(const float *src, float *dst, unsigned frames, float left, float right);
+
+    //dst += src * gain
+    void (*mix)(float *dst, const float *src, unsigned n, float gain);
+
+    //dst += src * g，g 按 gainRamp 的规则从 start 线性变化到 end
+    void (*mixRamp)(float *dst, const float *src, unsigned n, float start, float end);
+
+    //单声道叠加到交错立体声：左右声道的增益各自从 start 线性变化到 end
+    void (*mixPanRamp)(float *dst, const float *src, unsigned frames, float leftStart,
+                       float leftEnd, float rightStart, float rightEnd);
+
+    void (*interleave)(const float *left, const float *right, float *dst, unsigned frames);
+
+    void (*deinterleave)(const float *src, float *left, float *right, unsigned frames);
+
+    float (*dotProduct)(const float *a, const float *b, unsigned n);
+} DspKernels;
+
+//选出当前 CPU 上最快的一组内核，库加载时调用一次
+void dspInit(void);
+
+//指定指令集的内核，当前构建或 CPU 不支持时返回 NULL
+const DspKernels *dspKernels(DspIsa isa);
+
+//dspInit 选出的内核
+extern const DspKernels *dsp;
+
+#endif //NATIVEAUDIO_DSP_KERNELS_H
@@ -0,0 +1,265 @@
+//主机上的驱动程序：不需要设备，用 null/WAV 后端跑和手机上完全相同的引擎代码。
+//
+//    native-audio-host [-o out.wav] [-r 采样率] [-b 突发帧数] [-q 质量] [-s 秒数]
+//                      [-f s16|float] [-d 0|1] [-c 1|2] [-p 声像] [-v 混响预设]
+//                      剪辑[:次数][~起点-终点[+交叉淡化]][@秒] ...
+//
+//剪辑编号与 MainActivity 相同（1 = hello，2 = android，3 = sawtooth），@ 后面是触发时刻，精确到帧。
+//~ 给内置剪辑一个循环区间（剪辑自己采样率下的帧），次数是区间重复的次数，-1 表示一直重复。
+//剪辑也可以是一个 WAV 文件的路径：16 位单声道的 WAV 和手机上的资源走同一条 mmap 播放路径，
+//其它 WAV（多声道、8/24/32 位、float）先经过解码器放进引擎的解码资源缓存再播放。
+//-f 选择输出样本格式（float 时写 32 位 float WAV），-d 0 关掉 int16 输出的抖动，
+//-c 选择输出声道数，-p 是立体声输出的主声像（-1000 到 1000），-v 打开混响并选择 reverb.h 中的
+//I3DL2 预设（13 = STONECORRIDOR）。
+//没有 -o 时使用 null 后端，只报告渲染耗时。时钟由渲染的帧数决定，所以每次运行的输出逐位相同，
+//可以直接比较 WAV 文件做回归测试
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "audio_backend.h"
+#include "audio_engine.h"
+#include "mapped_wav.h"
+
+#define MAX_TRIGGERS 64
+
+typedef struct {
+    //which 为 CLIP_NONE 时播放 wav，不能直接映射的文件解码后按路径 asset 播放
+    MappedWav wav;
+    char *asset;
+    int which;
+    int count;
+    uint64_t frame;
+    ClipLoop loop;
+    bool looped;
+} Trigger;
+
+static void usage(void) {
+    fprintf(stderr, "usage: native-audio-host [-o out.wav] [-r rate] [-b burst] [-q 0|1|2] "
+                    "[-s seconds] [-f s16|float] [-d 0|1] [-c 1|2] [-p permille] [-v preset] "
+                    "clip|file.wav[:count][~start-end[+crossfade]][@seconds] ...\n");
+}
+
+//把文件整个解码进引擎的资源缓存，开始渲染前同步完成，输出与运行时机无关
+static bool loadAsset(AudioEngine *engine, const char *path) {
+    struct stat st;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    AudioDecoderSource source = {fd, 0, 0, 0};
+    AudioDecoder *decoder = NULL;
+    if (fstat(fd, &st) == 0) {
+        source.length = st.st_size;
+        decoder = audioDecoderOpenWav(&source);
+    }
+    close(fd);
+    return decoder != NULL && audioEngineLoadAsset(engine, path, decoder, false);
+}
+
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv) {
+    const char *output = NULL;
+    unsigned sampleRate = 48000;
+    unsigned burstFrames = 256;
+    int quality = -1;
+    double seconds = 2.0;
+    AudioSampleFormat format = AUDIO_FORMAT_S16;
+    bool dither = true;
+    unsigned channels = 1;
+    int pan = 0;
+    int reverbPreset = -1;
+    Trigger triggers[MAX_TRIGGERS];
+    unsigned triggerCount = 0;
+    int i;
+
+    memset(triggers, 0, sizeof(triggers));
+    for (i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if (arg[0] == '-' && arg[1] != '\0' && arg[2] == '\0' && i + 1 < argc) {
+            const char *value = argv[++i];
+            switch (arg[1]) {
+                case 'o':
+                    output = value;
+                    break;
+                case 'r':
+                    sampleRate = (unsigned) strtoul(value, NULL, 10);
+                    break;
+                case 'b':
+                    burstFrames = (unsigned) strtoul(value, NULL, 10);
+                    break;
+                case 'q':
+                    quality = atoi(value);
+                    break;
+                case 's':
+                    seconds = atof(value);
+                    break;
+                case 'f':
+                    if (strcmp(value, "float") == 0) {
+                        format = AUDIO_FORMAT_FLOAT;
+                    } else if (strcmp(value, "s16") != 0) {
+                        usage();
+                        return 2;
+                    }
+                    break;
+                case 'd':
+                    dither = atoi(value) != 0;
+                    break;
+                case 'c':
+                    channels = (unsigned) strtoul(value, NULL, 10);
+                    break;
+                case 'p':
+                    pan = atoi(value);
+                    break;
+                case 'v':
+                    reverbPreset = atoi(value);
+                    if (reverbPreset < 0 || reverbPreset >= REVERB_PRESET_COUNT) {
+                        usage();
+                        return 2;
+                    }
+                    break;
+                default:
+                    usage();
+                    return 2;
+            }
+        } else if (arg[0] != '-' && triggerCount < MAX_TRIGGERS) {
+            Trigger *trigger = &triggers[triggerCount];
+            //路径里可能有 ':' 或 '@'，只在最后一级文件名里找
+            const char *name = strrchr(arg, '/') != NULL ? strrchr(arg, '/') + 1 : arg;
+            const char *count = strchr(name, ':');
+            const char *at = strchr(name, '@');
+            if (arg[0] >= '0' && arg[0] <= '9') {
+                trigger->which = atoi(arg);
+            } else {
+                const char *end = count != NULL ? count : at != NULL ? at : name + strlen(name);
+                size_t length = (size_t) (end - arg);
+                char path[4096];
+                if (length >= sizeof(path)) {
+                    usage();
+                    return 2;
+                }
+                memcpy(path, arg, length);
+                path[length] = '\0';
+                if (!mappedWavOpen(&trigger->wav, path, 0)) {
+                    trigger->asset = (char *) malloc(length + 1);
+                    if (trigger->asset == NULL) {
+                        return 1;
+                    }
+                    memcpy(trigger->asset, path, length + 1);
+                }
+                trigger->which = CLIP_NONE;
+            }
+            const char *loop = strchr(name, '~');
+            if (loop != NULL) {
+                if (trigger->which == CLIP_NONE ||
+                    sscanf(loop + 1, "%u-%u+%u", &trigger->loop.start, &trigger->loop.end,
+                           &trigger->loop.crossfade) < 2) {
+                    usage();
+                    return 2;
+                }
+                trigger->looped = true;
+            }
+            ++triggerCount;
+            trigger->count = count != NULL ? atoi(count + 1) : 1;
+            trigger->frame = at != NULL ? (uint64_t) (atof(at + 1) * sampleRate) : 0;
+        } else {
+            usage();
+            return 2;
+        }
+    }
+    if (sampleRate == 0 || burstFrames == 0 || seconds <= 0 || channels < 1 || channels > 2) {
+        usage();
+        return 2;
+    }
+
+    AudioEngine *engine = audioEngineCreate();
+    if (engine == NULL || !audioEngineInit(engine, sampleRate, burstFrames)) {
+        fprintf(stderr, "audioEngineInit failed\n");
+        audioEngineDestroy(engine);
+        return 1;
+    }
+    if (quality >= 0) {
+        audioEngineSetResamplerQuality(engine, quality);
+    }
+    audioEngineSetDither(engine, dither);
+    audioEngineSetPan(engine, pan);
+    if (reverbPreset >= 0) {
+        audioEngineSetReverbPreset(engine, reverbPreset);
+        audioEngineEnableReverb(engine, true);
+    }
+    for (i = 0; i < (int) triggerCount; ++i) {
+        if (triggers[i].asset != NULL && !loadAsset(engine, triggers[i].asset)) {
+            fprintf(stderr, "cannot decode %s\n", triggers[i].asset);
+            audioEngineDestroy(engine);
+            return 1;
+        }
+    }
+    AudioBackend *backend = output != NULL
+                            ? audioBackendCreateWav(output, sampleRate, burstFrames, channels,
+                                                    format, audioEngineRender, engine)
+                            : audioBackendCreateNull(sampleRate, burstFrames, channels,
+                                                     format, audioEngineRender, engine);
+    if (backend == NULL || !audioBackendStart(backend)) {
+        fprintf(stderr, "cannot start %s backend\n", output != NULL ? output : "null");
+        audioBackendDestroy(backend);
+        audioEngineDestroy(engine);
+        return 1;
+    }
+
+    //所有触发都在开始渲染前作为定时事件交给引擎，剪辑精确地从触发时刻的那一帧开始
+    for (i = 0; i < (int) triggerCount; ++i) {
+        Trigger *trigger = &triggers[i];
+        bool ok = trigger->which != CLIP_NONE
+                  ? audioEngineScheduleClip(engine, trigger->frame, trigger->which,
+                                            trigger->count,
+                                            trigger->looped ? &trigger->loop : NULL)
+                  : trigger->asset != NULL
+                  ? audioEngineScheduleAsset(engine, trigger->frame, trigger->asset,
+                                             trigger->count)
+                  : audioEngineSchedulePcm(engine, trigger->frame, trigger->wav.pcm,
+                                           trigger->wav.frames, trigger->wav.sampleRate,
+                                           trigger->count, &trigger->wav.refs);
+        if (!ok) {
+            fprintf(stderr, "trigger %d failed\n", i);
+        }
+    }
+    uint64_t totalFrames = (uint64_t) (seconds * sampleRate);
+    double renderSeconds = 0;
+    while (backend->framesRendered < totalFrames) {
+        double start = nowSeconds();
+        if (audioBackendPump(backend, burstFrames) == 0) {
+            fprintf(stderr, "%s backend stopped\n", backend->ops->name);
+            break;
+        }
+        renderSeconds += nowSeconds() - start;
+    }
+
+    uint64_t frames = backend->framesRendered;
+    printf("backend=%s format=%s channels=%u rate=%u burst=%u frames=%llu "
+           "render_ns_per_frame=%.2f realtime_x=%.1f\n",
+           backend->ops->name, format == AUDIO_FORMAT_FLOAT ? "float" : "s16", channels,
+           sampleRate, burstFrames, (unsigned long long) frames,
+           frames ? renderSeconds * 1e9 / frames : 0.0,
+           renderSeconds > 0 ? frames / (double) sampleRate / renderSeconds : 0.0);
+
+    audioBackendDestroy(backend);
+    audioEngineDestroy(engine);
+    for (i = 0; i < (int) triggerCount; ++i) {
+        mappedWavUnmap(&triggers[i].wav);
+        free(triggers[i].asset);
+    }
+    return 0;
+}
@@ -0,0 +1,115 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "mapped_wav.h"
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static unsigned getLe16(const unsigned char *p) {
+    return p[0] | (unsigned) p[1] << 8;
+}
+
+static uint32_t getLe32(const unsigned char *p) {
+    return p[0] | (uint32_t) p[1] << 8 | (uint32_t) p[2] << 16 | (uint32_t) p[3] << 24;
+}
+
+//逐块扫描 RIFF，找到 fmt 和 data。data 块长度不可信（例如写到一半的录音把它留成 0），
+//超出文件时按文件实际剩余的长度算
+static bool parseWav(MappedWav *wav, const unsigned char *data, size_t bytes) {
+    if (bytes < 12 || memcmp(data, "RIFF", 4) != 0 || memcmp(data + 8, "WAVE", 4) != 0) {
+        return false;
+    }
+    bool haveFormat = false;
+    size_t offset = 12;
+    while (offset + 8 <= bytes) {
+        const unsigned char *chunk = data + offset;
+        size_t chunkBytes = getLe32(chunk + 4);
+        size_t body = offset + 8;
+        if (memcmp(chunk, "fmt ", 4) == 0) {
+            if (chunkBytes < 16 || body + 16 > bytes) {
+                return false;
+            }
+            unsigned format = getLe16(data + body);
+            unsigned channels = getLe16(data + body + 2);
+            unsigned bits = getLe16(data + body + 14);
+            //0xFFFE 是 WAVE_FORMAT_EXTENSIBLE，子格式不再细查，只看声道数和位深
+            if ((format != 1 && format != 0xFFFE) || channels != 1 || bits != 16) {
+                return false;
+            }
+            wav->sampleRate = getLe32(data + body + 4);
+            haveFormat = true;
+        } else if (memcmp(chunk, "data", 4) == 0) {
+            //混音器按 short 读取，样本必须两字节对齐
+            if (!haveFormat || wav->sampleRate == 0 || (uintptr_t) (data + body) % 2 != 0) {
+                return false;
+            }
+            if (chunkBytes == 0 || chunkBytes > bytes - body) {
+                chunkBytes = bytes - body;
+            }
+            wav->pcm = (const short *) (data + body);
+            wav->frames = (unsigned) (chunkBytes / sizeof(short));
+            return wav->frames > 0;
+        }
+        //块按偶数字节对齐
+        offset = body + chunkBytes + (chunkBytes & 1);
+    }
+    return false;
+}
+
+bool mappedWavMapFd(MappedWav *wav, int fd, off_t start, off_t length, unsigned rawSampleRate) {
+    memset(wav, 0, sizeof(*wav));
+    atomic_init(&wav->refs, 0);
+    if (fd < 0 || start < 0 || length <= 0) {
+        return false;
+    }
+    //mmap 的偏移必须按页对齐，资源在 APK 里的位置不一定对齐
+    off_t page = (off_t) sysconf(_SC_PAGESIZE);
+    off_t slack = start % page;
+    size_t bytes = (size_t) (length + slack);
+    void *mapping = mmap(NULL, bytes, PROT_READ, MAP_PRIVATE, fd, start - slack);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+    const unsigned char *data = (const unsigned char *) mapping + slack;
+    wav->mapping = mapping;
+    wav->mappingBytes = bytes;
+    if (!parseWav(wav, data, (size_t) length)) {
+        if (rawSampleRate == 0 || memcmp(data, "RIFF", 4) == 0 || slack % 2 != 0 ||
+            length < (off_t) sizeof(short)) {
+            mappedWavUnmap(wav);
+            return false;
+        }
+        wav->pcm = (const short *) data;
+        wav->frames = (unsigned) (length / sizeof(short));
+        wav->sampleRate = rawSampleRate;
+    }
+    //提前读入页面，尽量不让音频回调第一次碰到某一页时等磁盘
+    posix_madvise(mapping, bytes, POSIX_MADV_WILLNEED);
+    return true;
+}
+
+bool mappedWavOpen(MappedWav *wav, const char *path, unsigned rawSampleRate) {
+    memset(wav, 0, sizeof(*wav));
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    bool ok = fstat(fd, &st) == 0 && mappedWavMapFd(wav, fd, 0, st.st_size, rawSampleRate);
+    close(fd);
+    return ok;
+}
+
+void mappedWavUnmap(MappedWav *wav) {
+    if (wav->mapping != NULL) {
+        munmap(wav->mapping, wav->mappingBytes);
+    }
+    wav->mapping = NULL;
+    wav->mappingBytes = 0;
+    wav->pcm = NULL;
+    wav->frames = 0;
+}
@@ -0,0 +1,33 @@
+#ifndef NATIVEAUDIO_MAPPED_WAV_H
+#define NATIVEAUDIO_MAPPED_WAV_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <sys/types.h>
+
+//把未压缩的 WAV（或裸 PCM）文件区间直接 mmap 进来，混音器从映射里读样本，不做任何拷贝。
+//只接受 16 位单声道 PCM，也就是混音器声部本身的格式；其它格式返回 false，由调用方另选播放方式。
+//样本按主机字节序直接读取，Android 和常见主机都是小端序，与 WAV 一致
+typedef struct MappedWav {
+    void *mapping;
+    size_t mappingBytes;
+    //data 块在映射中的位置
+    const short *pcm;
+    unsigned frames;
+    unsigned sampleRate;
+    //正在播放这份映射的声部数，归零之前不能解除映射
+    atomic_int refs;
+} MappedWav;
+
+//映射 fd 中从 start 开始的 length 字节，例如 AAsset_openFileDescriptor 返回的区间。
+//rawSampleRate 不为 0 时，没有 RIFF 文件头的数据按这个采样率的裸 16 位单声道 PCM 处理。
+//映射建立后 fd 可以立即关闭
+bool mappedWavMapFd(MappedWav *wav, int fd, off_t start, off_t length, unsigned rawSampleRate);
+
+//映射整个普通文件，主机上的驱动程序和基准测试用
+bool mappedWavOpen(MappedWav *wav, const char *path, unsigned rawSampleRate);
+
+//调用前必须确认 refs 已经归零（或者音频回调已经不再运行）
+void mappedWavUnmap(MappedWav *wav);
+
+#endif //NATIVEAUDIO_MAPPED_WAV_H
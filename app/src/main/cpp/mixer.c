@@ -0,0 +1,325 @@
+#include "mixer.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dsp_kernels.h"
+
+bool mixerInit(Mixer *mixer, unsigned maxFrames) {
+    int i;
+    memset(mixer, 0, sizeof(*mixer));
+    for (i = 0; i < MIXER_MAX_GROUPS; ++i) {
+        MixerGroup *group = &mixer->groups[i];
+        group->left = group->right = group->targetLeft = group->targetRight = 1.0f;
+    }
+    mixer->voiceS16 = (short *) malloc(maxFrames * sizeof(short));
+    mixer->voiceF32 = (float *) malloc(maxFrames * sizeof(float));
+    if (mixer->voiceS16 == NULL || mixer->voiceF32 == NULL) {
+        mixerRelease(mixer);
+        return false;
+    }
+    mixer->maxFrames = maxFrames;
+    return true;
+}
+
+void mixerRelease(Mixer *mixer) {
+    free(mixer->voiceS16);
+    free(mixer->voiceF32);
+    mixer->voiceS16 = NULL;
+    mixer->voiceF32 = NULL;
+    mixer->maxFrames = 0;
+}
+
+static void releaseVoice(MixerVoice *voice) {
+    if (voice->active && voice->refs != NULL) {
+        atomic_fetch_sub_explicit(voice->refs, 1, memory_order_release);
+    }
+    if (voice->active && voice->filterRefs != NULL) {
+        atomic_fetch_sub_explicit(voice->filterRefs, 1, memory_order_release);
+    }
+    voice->active = false;
+    voice->refs = NULL;
+    voice->filterRefs = NULL;
+}
+
+int mixerPlay(Mixer *mixer, const short *buffer, unsigned frames, int count,
+              const ResamplerFilter *filter, float gain, int group, atomic_int *refs) {
+    int i, slot = 0;
+    for (i = 0; i < MIXER_MAX_VOICES; ++i) {
+        if (!mixer->voices[i].active) {
+            slot = i;
+            break;
+        }
+        if (mixer->voices[i].serial < mixer->voices[slot].serial) {
+            slot = i;
+        }
+    }
+    MixerVoice *voice = &mixer->voices[slot];
+    releaseVoice(voice);
+    voice->buffer = buffer;
+    voice->frames = frames;
+    voice->position = 0;
+    voice->count = count;
+    voice->loopStart = 0;
+    voice->loopEnd = frames;
+    voice->crossfade = 0;
+    voice->gain = gain;
+    voice->group = group >= 0 && group < MIXER_MAX_GROUPS ? group : 0;
+    voice->resampling = filter != NULL;
+    if (voice->resampling) {
+        resamplerInit(&voice->resampler, filter);
+        voice->flushFrames = resamplerFlushFrames(&voice->resampler);
+    }
+    voice->serial = mixer->nextSerial++;
+    voice->refs = refs;
+    voice->ready = NULL;
+    voice->active = true;
+    if (frames == 0 || count == 0) {
+        releaseVoice(voice);
+    }
+    return slot;
+}
+
+void mixerSetVoiceLoop(Mixer *mixer, int voice, unsigned start, unsigned end,
+                       unsigned crossfade) {
+    MixerVoice *v = &mixer->voices[voice];
+    if (end > v->frames) {
+        end = v->frames;
+    }
+    if (start >= end) {
+        return;
+    }
+    v->loopStart = start;
+    v->loopEnd = end;
+    v->crossfade = crossfade < (end - start) / 2 ? crossfade : (end - start) / 2;
+}
+
+void mixerSetVoiceFilterRefs(Mixer *mixer, int voice, atomic_int *filterRefs) {
+    MixerVoice *v = &mixer->voices[voice];
+    if (!v->active) {
+        atomic_fetch_sub_explicit(filterRefs, 1, memory_order_release);
+        return;
+    }
+    v->filterRefs = filterRefs;
+}
+
+void mixerSetVoiceReady(Mixer *mixer, int voice, const atomic_uint *ready) {
+    mixer->voices[voice].ready = ready;
+}
+
+void mixerStopAll(Mixer *mixer) {
+    int i;
+    for (i = 0; i < MIXER_MAX_VOICES; ++i) {
+        releaseVoice(&mixer->voices[i]);
+    }
+}
+
+void mixerStopSource(Mixer *mixer, const atomic_int *refs) {
+    int i;
+    for (i = 0; i < MIXER_MAX_VOICES; ++i) {
+        if (mixer->voices[i].refs == refs) {
+            releaseVoice(&mixer->voices[i]);
+        }
+    }
+}
+
+unsigned mixerActiveVoices(const Mixer *mixer) {
+    unsigned n = 0;
+    int i;
+    for (i = 0; i < MIXER_MAX_VOICES; ++i) {
+        n += mixer->voices[i].active;
+    }
+    return n;
+}
+
+//还会回到 loopStart 的一遍在 loopEnd 处结束，最后一遍播到剪辑末尾
+static bool voiceLooping(const MixerVoice *voice) {
+    return voice->count != 1;
+}
+
+//源 PCM 中已经可以读取的帧数
+static unsigned voiceReady(const MixerVoice *voice) {
+    if (voice->ready == NULL) {
+        return voice->frames;
+    }
+    return atomic_load_explicit(voice->ready, memory_order_acquire);
+}
+
+//从当前位置开始能连续读取的源帧。普通的一段直接指向剪辑，不受 capacity 限制；
+//交叉淡化的一段最多合成 capacity 帧到 scratch。源还没解码到当前位置时返回 0
+static unsigned voiceSpan(const MixerVoice *voice, short *scratch, unsigned capacity,
+                          const short **src) {
+    unsigned ready = voiceReady(voice);
+    unsigned end = voiceLooping(voice) ? voice->loopEnd - voice->crossfade : voice->frames;
+    if (voice->position < end) {
+        *src = voice->buffer + voice->position;
+        return (end < ready ? end : ready) - voice->position;
+    }
+    end = voice->loopEnd < ready ? voice->loopEnd : ready;
+    unsigned n = end - voice->position;
+    unsigned i;
+    if (n > capacity) {
+        n = capacity;
+    }
+    //淡出的区间末尾和淡入的区间开头按 sqrt 增益相加，总功率不变
+    unsigned seam = voice->loopEnd - voice->crossfade;
+    for (i = 0; i < n; ++i) {
+        unsigned k = voice->position - seam + i;
+        float t = (k + 0.5f) / voice->crossfade;
+        float out = voice->buffer[voice->position + i] * sqrtf(1.0f - t) +
+                    voice->buffer[voice->loopStart + k] * sqrtf(t);
+        long sample = lrintf(out);
+        scratch[i] = (short) (sample > 32767 ? 32767 : sample < -32768 ? -32768 : sample);
+    }
+    *src = scratch;
+    return n;
+}
+
+//读完 n 帧：到达 loopEnd 时跳回区间开头并消耗一次次数，最后一遍到达剪辑末尾时次数归零
+static void voiceAdvance(MixerVoice *voice, unsigned n) {
+    voice->position += n;
+    if (voiceLooping(voice)) {
+        if (voice->position == voice->loopEnd) {
+            voice->position = voice->loopStart + voice->crossfade;
+            if (voice->count > 0) {
+                --voice->count;
+            }
+        }
+    } else if (voice->position == voice->frames) {
+        voice->count = 0;
+    }
+}
+
+//把源剪辑重采样到 dst，循环播放时滤波器状态跨过接缝保持连续。
+//最后一遍读完后再送入静音冲刷滤波器尾部，然后释放声部
+static unsigned renderResampledVoice(MixerVoice *voice, short *dst, unsigned frames) {
+    short scratch[MIXER_SEAM_FRAMES];
+    unsigned written = 0;
+    while (written < frames && voice->active) {
+        if (voice->count != 0) {
+            const short *src;
+            unsigned in = voiceSpan(voice, scratch, MIXER_SEAM_FRAMES, &src);
+            if (in == 0) {
+                break;
+            }
+            written += resamplerProcess(&voice->resampler, src, &in, dst + written,
+                                        frames - written);
+            voiceAdvance(voice, in);
+        } else {
+            unsigned in = voice->flushFrames;
+            written += resamplerProcess(&voice->resampler, NULL, &in, dst + written,
+                                        frames - written);
+            voice->flushFrames -= in;
+            if (voice->flushFrames == 0) {
+                releaseVoice(voice);
+            }
+        }
+    }
+    return written;
+}
+
+//源已经是输出采样率，直接拷贝，交叉淡化的部分直接合成到 dst；播完最后一遍时释放声部
+static unsigned renderDirectVoice(MixerVoice *voice, short *dst, unsigned frames) {
+    unsigned written = 0;
+    while (written < frames && voice->active) {
+        const short *src;
+        unsigned n = voiceSpan(voice, dst + written, frames - written, &src);
+        if (n == 0) {
+            break;
+        }
+        if (n > frames - written) {
+            n = frames - written;
+        }
+        if (src != dst + written) {
+            memcpy(dst + written, src, n * sizeof(short));
+        }
+        written += n;
+        voiceAdvance(voice, n);
+        if (voice->count == 0) {
+            releaseVoice(voice);
+        }
+    }
+    return written;
+}
+
+void mixerSetGroupGain(Mixer *mixer, int group, float left, float right, unsigned rampFrames) {
+    MixerGroup *g = &mixer->groups[group];
+    if (left == g->targetLeft && right == g->targetRight) {
+        return;
+    }
+    g->targetLeft = left;
+    g->targetRight = right;
+    g->remaining = rampFrames;
+    if (rampFrames == 0) {
+        g->left = left;
+        g->right = right;
+    }
+}
+
+//增益从 (leftStart, rightStart) 线性变化到 (leftEnd, rightEnd)，单声道只用左声道的增益
+static void mixSegment(float *out, const float *src, unsigned frames, unsigned channels,
+                       float leftStart, float leftEnd, float rightStart, float rightEnd) {
+    if (channels == 2) {
+        if (leftStart != 0.0f || leftEnd != 0.0f || rightStart != 0.0f || rightEnd != 0.0f) {
+            dsp->mixPanRamp(out, src, frames, leftStart, leftEnd, rightStart, rightEnd);
+        }
+    } else if (leftStart != leftEnd) {
+        dsp->mixRamp(out, src, frames, leftStart, leftEnd);
+    } else if (leftStart != 0.0f) {
+        dsp->mix(out, src, frames, leftStart);
+    }
+}
+
+void mixerMixGroup(const Mixer *mixer, int group, float *out, const float *src, unsigned frames,
+                   unsigned channels, float gain) {
+    const MixerGroup *g = &mixer->groups[group];
+    //过渡在这个突发里结束时分成两段：先过渡到目标，剩下的按目标增益
+    unsigned ramp = g->remaining < frames ? g->remaining : frames;
+    if (ramp > 0) {
+        float t = (float) ramp / g->remaining;
+        float left = g->left + (g->targetLeft - g->left) * t;
+        float right = g->right + (g->targetRight - g->right) * t;
+        mixSegment(out, src, ramp, channels, gain * g->left, gain * left, gain * g->right,
+                   gain * right);
+    }
+    if (ramp < frames) {
+        mixSegment(out + ramp * channels, src + ramp, frames - ramp, channels,
+                   gain * g->targetLeft, gain * g->targetLeft, gain * g->targetRight,
+                   gain * g->targetRight);
+    }
+}
+
+void mixerRender(Mixer *mixer, float *out, unsigned frames, unsigned channels) {
+    int i;
+    for (i = 0; i < MIXER_MAX_VOICES; ++i) {
+        MixerVoice *voice = &mixer->voices[i];
+        if (!voice->active) {
+            continue;
+        }
+        unsigned n = voice->resampling ? renderResampledVoice(voice, mixer->voiceS16, frames)
+                                       : renderDirectVoice(voice, mixer->voiceS16, frames);
+        dsp->s16ToF32(mixer->voiceS16, mixer->voiceF32, n);
+        mixerMixGroup(mixer, voice->group, out, mixer->voiceF32, n, channels, voice->gain);
+    }
+}
+
+void mixerAdvanceGroups(Mixer *mixer, unsigned frames) {
+    int i;
+    for (i = 0; i < MIXER_MAX_GROUPS; ++i) {
+        MixerGroup *g = &mixer->groups[i];
+        if (g->remaining == 0) {
+            continue;
+        }
+        if (g->remaining <= frames) {
+            g->left = g->targetLeft;
+            g->right = g->targetRight;
+            g->remaining = 0;
+        } else {
+            float t = (float) frames / g->remaining;
+            g->left += (g->targetLeft - g->left) * t;
+            g->right += (g->targetRight - g->right) * t;
+            g->remaining -= frames;
+        }
+    }
+}
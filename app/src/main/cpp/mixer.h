@@ -0,0 +1,114 @@
+#ifndef NATIVEAUDIO_MIXER_H
+#define NATIVEAUDIO_MIXER_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+
+#include "resampler.h"
+
+//软件混音器：固定容量的声部表，每个声部有自己的源剪辑、播放位置、剩余次数和增益，
+//每个突发把所有活动声部叠加到同一个 float 输出缓冲区（单声道或交错立体声）。
+//每个声部属于一个声部组，组的左右增益变化时在若干帧内逐样本线性过渡，不会产生拉链噪声。
+//除 mixerInit/mixerRelease 外都只在音频回调线程中调用，不分配内存
+#define MIXER_MAX_VOICES 8
+#define MIXER_MAX_GROUPS 8
+//播放次数为它时循环区间一直重复，直到声部被停止
+#define MIXER_LOOP_FOREVER (-1)
+//重采样的声部每次合成这么多帧交叉淡化的样本送进重采样器
+#define MIXER_SEAM_FRAMES 64
+
+typedef struct MixerGroup {
+    //这个突发开始时的增益，单声道输出只用 left
+    float left;
+    float right;
+    float targetLeft;
+    float targetRight;
+    //还要多少帧到达目标，0 表示已经到达
+    unsigned remaining;
+} MixerGroup;
+
+typedef struct MixerVoice {
+    bool active;
+    const short *buffer;
+    unsigned frames;
+    //下一次要读取的源帧位置
+    unsigned position;
+    //循环区间 [loopStart, loopEnd) 还要播放的次数，MIXER_LOOP_FOREVER 表示不限。
+    //先播放区间之前的部分，最后一遍播完区间之后的部分；默认区间是整个剪辑
+    int count;
+    unsigned loopStart;
+    unsigned loopEnd;
+    //每次回到 loopStart 之前，区间末尾的这么多帧和 loopStart 开始的帧做等功率交叉淡化，
+    //然后从 loopStart + crossfade 继续，接缝处没有跳变
+    unsigned crossfade;
+    float gain;
+    //源采样率与输出采样率不同时逐突发重采样
+    bool resampling;
+    Resampler resampler;
+    //最后一遍读完后还要送入的静音帧数，用于冲刷重采样滤波器尾部
+    unsigned flushFrames;
+    //开始播放的顺序号，声部用完时抢占最早开始的那个
+    unsigned serial;
+    int group;
+    //源 PCM 的引用计数（例如剪辑缓存条目），声部结束时减一，可以为 NULL
+    atomic_int *refs;
+    //resampler 使用的系数表的引用计数，同样在声部结束时减一，可以为 NULL
+    atomic_int *filterRefs;
+    //源 PCM 还在渐进解码时指向已经解码好的帧数，声部只读它之前的帧，追上解码时这个突发剩下的部分静音；
+    //为 NULL 时整个源都可以读
+    const atomic_uint *ready;
+} MixerVoice;
+
+typedef struct Mixer {
+    MixerVoice voices[MIXER_MAX_VOICES];
+    MixerGroup groups[MIXER_MAX_GROUPS];
+    unsigned maxFrames;
+    unsigned nextSerial;
+    //单个声部一个突发的 int16/float 工作区
+    short *voiceS16;
+    float *voiceF32;
+} Mixer;
+
+bool mixerInit(Mixer *mixer, unsigned maxFrames);
+
+void mixerRelease(Mixer *mixer);
+
+//开始一个新声部，filter 为 NULL 表示源已经是输出采样率。
+//refs 不为 NULL 时，声部结束（播完、被停止或被抢占）时对它减一。返回声部下标
+int mixerPlay(Mixer *mixer, const short *buffer, unsigned frames, int count,
+              const ResamplerFilter *filter, float gain, int group, atomic_int *refs);
+
+//设置刚开始的声部的循环区间（源剪辑的帧）。end 超出剪辑时截到末尾，区间为空时保持整个剪辑；
+//crossfade 最多是区间长度的一半
+void mixerSetVoiceLoop(Mixer *mixer, int voice, unsigned start, unsigned end,
+                       unsigned crossfade);
+
+//设置刚开始的声部的系数表引用计数，见 MixerVoice.filterRefs。声部已经结束时立即减一
+void mixerSetVoiceFilterRefs(Mixer *mixer, int voice, atomic_int *filterRefs);
+
+//设置刚开始的声部的源 PCM 已解码帧数，见 MixerVoice.ready
+void mixerSetVoiceReady(Mixer *mixer, int voice, const atomic_uint *ready);
+
+void mixerStopAll(Mixer *mixer);
+
+//停止所有引用计数为 refs 的声部，也就是播放同一份源 PCM 的声部
+void mixerStopSource(Mixer *mixer, const atomic_int *refs);
+
+unsigned mixerActiveVoices(const Mixer *mixer);
+
+//设置组的目标增益，rampFrames 帧后到达；正在过渡时从当前值重新开始过渡
+void mixerSetGroupGain(Mixer *mixer, int group, float left, float right, unsigned rampFrames);
+
+//把单声道的 src 乘以 gain 和组的（过渡中的）增益，叠加到有 channels 个声道的 out。
+//混音器之外的信号（例如监听输入）也用它跟随组增益
+void mixerMixGroup(const Mixer *mixer, int group, float *out, const float *src, unsigned frames,
+                   unsigned channels, float gain);
+
+//把所有活动声部叠加到 out（frames <= maxFrames，channels 为 1 或 2），播完的声部自动释放。
+//out 要先清零或者已经有其它信号，调用方可以分几段渲染一个突发
+void mixerRender(Mixer *mixer, float *out, unsigned frames, unsigned channels);
+
+//每个突发的混音全部完成后调用一次，把组增益的过渡推进 frames 帧
+void mixerAdvanceGroups(Mixer *mixer, unsigned frames);
+
+#endif //NATIVEAUDIO_MIXER_H
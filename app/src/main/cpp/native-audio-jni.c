@@ -1,8 +1,15 @@
+#define _POSIX_C_SOURCE 200809L
+
 #include <assert.h>
+#include <limits.h>
 #include <jni.h>
 #include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#include <unistd.h>
 
 #include <SLES/OpenSLES.h>
 #include <SLES/OpenSLES_Android.h>
@@ -12,407 +19,654 @@
 #include <android/asset_manager_jni.h>
 #include <sys/types.h>
 
+#include "audio_engine.h"
+#include "backend_opensl.h"
+#include "callback_stats.h"
+#include "capture_decimator.h"
+#include "decoder_mediacodec.h"
+#include "mapped_wav.h"
+#include "player_pool.h"
+#include "record_writer.h"
+
 #define UNUSED(x) (void)(x);
 
-static const char hello[] =
-#include "hello_clip.h"
-        ;
-//这种写法不对，#include "android_clip.h" 不是一个常量表达式，因为它的值只有在编译时才能确定。
-//static const char android[] = #include "android_clip.h";
-
-//在C++中，#include是一个预处理指令，它告诉编译器在编译时将指定的头文件包含到程序中。
-// 当你在头文件中定义一个静态常量字符数组时，你需要使用一个常量表达式来初始化它。
-// 常量表达式是指值不会改变并且在编译时就可以计算出来的表达式。
-// 因此，如果你想在头文件中定义静态常量字符数组，你需要使用一个常量表达式来初始化它。
-//
-//换行符只是用来分隔代码的一种方式，它不会影响程序的语义。
-// 因此，当你在头文件中定义静态常量字符数组时，你可以使用换行符来分隔代码行，以使代码更易于阅读和维护。
-static const char android[] =
-#include "android_clip.h"
-        ;
-// engine interfaces
-static SLObjectItf engineObject = NULL;
-static SLEngineItf enginEngine;
-
-// output mix interfaces
-static SLObjectItf outputMixObject = NULL;
-static SLEnvironmentalReverbItf outputMixEnvironmentalReverb = NULL;
-
-const SLEnvironmentalReverbSettings reverbSettings = SL_I3DL2_ENVIRONMENT_PRESET_STONECORRIDOR;
-
-static SLmilliHertz bqPlayerSampleRate = 0;
-static jint bqPlayerBufSize = 0;
-static SLObjectItf bqPlayerObject = NULL;
-static SLPlayItf bqPlayerPlay;
-static SLAndroidSimpleBufferQueueItf bqPlayerBufferQueue;
-static SLEffectSendItf bqPlayerEffectSend;
-static SLVolumeItf bqPlayerVolume;
-static short *resampleBuf = NULL;
-
-//要排队的下一个播放器缓冲区的指针和大小，以及剩余缓冲区的数量
-static short *nextBuffer;
-static unsigned nextSize;
-static int nextCount;
-
-static pthread_mutex_t audioEngineLock = PTHREAD_MUTEX_INITIALIZER;
-
-static SLObjectItf fdPlayerObject = NULL;
-static SLPlayItf fdPlayerPlay;
-static SLSeekItf fdPlayerSeek;
-static SLMuteSoloItf fdPlayerMuteSolo;
-static SLVolumeItf fdPlayerVolume;
-
-// URI player interfaces
-static SLObjectItf uriPlayerObject = NULL;
-static SLPlayItf uriPlayerPlay;
-static SLSeekItf uriPlayerSeek;
-static SLMuteSoloItf uriPlayerMuteSolo;
-static SLVolumeItf uriPlayerVolume;
-
-static SLMuteSoloItf bqPlayerMuteSolo;
-
-// recorder interfaces
-static SLObjectItf recorderObject = NULL;
-static SLRecordItf recorderRecord;
-static SLAndroidSimpleBufferQueueItf recorderBufferQueue;
-
-// synthesized sawtooth clip
-#define SAWTOOTH_FRAMES 8000
-static short sawtoothBuffer[SAWTOOTH_FRAMES];
-
-// 以 16 kHz 单声道、16 位带符号小端序录制的 5 秒音频
-#define RECORDER_FRAMES (16000 * 5)
-static short recorderBuffer[RECORDER_FRAMES];
-static unsigned recorderSize = 0;
-
-//这段代码是在函数onDlOpen上面添加了一个特殊的属性__attribute__((constructor))，这个属性表示在函数初始化时会自动执行这个函数。
-// 因此，这个函数会在程序启动时自动执行。
-__attribute__((constructor)) static void onDlOpen(void) {
-    unsigned i;
-    for (i = 0; i < SAWTOOTH_FRAMES; ++i) {
-        sawtoothBuffer[i] = 32768 - ((i % 100) * 660);
-    }
+//没有拿到设备本机缓冲区大小时使用的突发帧数
+#define DEFAULT_BURST_FRAMES 256
+
+//连续录音：RECORDER_CAPTURE_BUFFERS 个小缓冲区在录音器的缓冲区队列中轮转，
+//每填满一个就交给引擎的消费者，然后立刻重新排队。内存固定，第一块数据只晚一个缓冲区的时长
+#define RECORDER_CAPTURE_BUFFERS 4
+//每块 20 ms
+#define RECORDER_CHUNKS_PER_SECOND 50
+#define RECORDER_MAX_DEVICE_RATE 192000
+#define RECORDER_MAX_CHUNK_FRAMES (RECORDER_MAX_DEVICE_RATE / RECORDER_CHUNKS_PER_SECOND)
+
+//16 位单声道 WAV 资源直接映射进内存，作为引擎的一个声部播放；其它格式（包括 MP3）解码进引擎的
+//解码资源缓存，同样作为声部播放，立体声的资源保留左右声道；解码不了时才创建 fd 播放器
+typedef struct {
+    MappedWav wav;
+    bool wavMapped;
+    //解码资源的键（资源名），没有时为 NULL
+    char *decoded;
+    //从 players 签出的 fd 播放器，没有时为 NULL
+    SlPlayer *fd;
+} AssetPlayer;
+
+typedef struct {
+    SLObjectItf object;
+    SLRecordItf record;
+    SLAndroidSimpleBufferQueueItf bufferQueue;
+    //按 float 分配，任何采集格式的一块都放得下
+    float chunks[RECORDER_CAPTURE_BUFFERS][RECORDER_MAX_CHUNK_FRAMES];
+    unsigned chunkFrames;
+    unsigned chunkBytes;
+    //下一个要填满的缓冲区，缓冲区队列按排队顺序完成
+    unsigned chunkIndex;
+    //录音器按设备本机采样率采集，避开平台的重采样，留在低延迟输入通路上；
+    //decimator 在录音回调里把每块转换成引擎的存储采样率
+    CaptureDecimator decimator;
+    short *storage;
+
+    //setRecordingFile 设置后，每次录音都由后台写线程保存到这个文件
+    char *path;
+    RecordFormat format;
+    RecordWriter *writer;
+} Recorder;
+
+//启动阶段，getStartupTimings 按这个顺序返回各阶段的耗时
+typedef enum {
+    //slCreateEngine 和引擎对象的实例化
+    STARTUP_PHASE_ENGINE = 0,
+    //从创建输出混音器到实例化完成
+    STARTUP_PHASE_OUTPUT_MIX,
+    //audioEngineInit：剪辑缓存、重采样和混响的准备
+    STARTUP_PHASE_CORE,
+    //创建、实例化并启动缓冲区队列播放器
+    STARTUP_PHASE_PLAYER,
+    //从播放器启动到第一个回调
+    STARTUP_PHASE_FIRST_CALLBACK,
+    STARTUP_PHASE_TOTAL,
+    STARTUP_PHASES,
+} StartupPhase;
+
+typedef struct {
+    //createEngine 或 createEngineAsync 进入的时刻（CLOCK_MONOTONIC）
+    uint64_t begin;
+    uint64_t playerStarted;
+    int64_t phases[STARTUP_PHASES];
+    pthread_t thread;
+    bool threadRunning;
+    //awaitEngine 可能同时在界面线程和后台线程里调用，只能有一个去 join
+    pthread_mutex_t joinLock;
+    //后台启动的结果，awaitEngine 之后才能读
+    bool ok;
+    //启动结束（无论成败）时用 release 置位，之后 phases 和 playerStarted 不再改变；
+    //其它线程 acquire 读到 true 之后才能读它们
+    atomic_bool done;
+    //输出混音器异步实例化的完成通知
+    pthread_mutex_t lock;
+    pthread_cond_t realized;
+    uint64_t outputMixBegin;
+    bool outputMixDone;
+    SLresult outputMixResult;
+} StartupState;
+
+//一个引擎上下文：OpenSL 引擎和输出混音器、缓冲区队列播放器和它背后的 AudioEngine，
+//以及挂在它下面的资源播放器、URI 播放器和录音器。createEngine 把它的地址作为 jlong 句柄交给 Kotlin，
+//其余 JNI 函数都只操作句柄指向的上下文，几个上下文可以在不同的组件或线程里各自运行
+typedef struct {
+    // engine interfaces
+    SLObjectItf engineObject;
+    SLEngineItf enginEngine;
+
+    // output mix interfaces
+    SLObjectItf outputMixObject;
+
+    SLmilliHertz bqPlayerSampleRate;
+    jint bqPlayerBufSize;
+    //所有剪辑都由 audio_engine 混合进同一个缓冲区队列播放器
+    AudioBackend *bqPlayerBackend;
+    AudioEngine *core;
+
+    //fd 和 URI 播放器都从这里签出，换资源或 URI 时把旧的还回去，不再泄漏对象和文件描述符
+    PlayerPool players;
+    //preloadAssetAudioPlayer 可以在后台线程里调用，它和界面线程上对池的签出、归还由这把锁串行化
+    pthread_mutex_t playersLock;
+    AssetPlayer asset;
+    // URI player interfaces
+    SlPlayer *uri;
+    Recorder recorder;
+
+    //播放和录音回调的计时统计，由 getCallbackStats 取快照
+    CallbackStats playerStats;
+    CallbackStats recorderStats;
+
+    //与 EnableStereoPosition 一样，关闭时记住声像位置但按居中播放
+    bool stereoEnabled;
+    int stereoPermille;
+
+    StartupState startup;
+} NativeEngine;
+
+static NativeEngine *fromHandle(jlong handle) {
+    return (NativeEngine *) (intptr_t) handle;
 }
 
-short *createResampleBuf(uint32_t idx, uint32_t srcRate, unsigned *size);
-
+//context 是录音器所属的引擎上下文
 void bqRecorderCallback(SLAndroidSimpleBufferQueueItf bq, void *context) {
-    assert(bq == recorderBufferQueue);
-    assert(NULL == context);
+    NativeEngine *engine = (NativeEngine *) context;
+    Recorder *recorder = &engine->recorder;
+    assert(bq == recorder->bufferQueue);
+    uint64_t arrival = callbackStatsNow();
+    float *chunk = recorder->chunks[recorder->chunkIndex];
+    recorder->chunkIndex = (recorder->chunkIndex + 1) % RECORDER_CAPTURE_BUFFERS;
+    //监听在抽取之前取数据，省掉一次降采样再升采样，也不受抽取滤波器的延迟影响
+    audioEngineMonitorChunk(engine->core,
+                            captureDecimatorNative(&recorder->decimator, chunk,
+                                                   recorder->chunkFrames),
+                            recorder->chunkFrames);
+    unsigned frames = captureDecimatorProcess(&recorder->decimator, chunk, recorder->chunkFrames,
+                                              recorder->storage);
+    audioEngineCaptureChunk(engine->core, recorder->storage, frames);
+    //数据已经交出去了，把缓冲区放回队尾继续录
     SLresult result;
-    result = (*recorderRecord)->SetRecordState(recorderRecord, SL_RECORDSTATE_STOPPED);
-    if (result == SL_RESULT_SUCCESS) {
-        recorderSize = RECORDER_FRAMES * sizeof(short);
-    }
-    pthread_mutex_unlock(&audioEngineLock);
+    result = (*bq)->Enqueue(bq, chunk, recorder->chunkBytes);
+    SLAndroidSimpleBufferQueueState state = {0, 0};
+    (*bq)->GetState(bq, &state);
+    //不算刚放回去的这个：为 0 说明录音器在等我们，数据可能已经丢了
+    unsigned queueDepth = result == SL_RESULT_SUCCESS && state.count > 0 ? state.count - 1 : 0;
+    callbackStatsRecord(&engine->recorderStats, arrival, callbackStatsNow(), queueDepth);
 }
 
-void releaseResampleBuf() {
-    if (0 == bqPlayerSampleRate) {
-        return;
-    }
-    free(resampleBuf);
-    resampleBuf = NULL;
+static uint64_t startupPhaseEnd(NativeEngine *engine, StartupPhase phase, uint64_t begin) {
+    uint64_t end = callbackStatsNow();
+    engine->startup.phases[phase] = (int64_t) (end - begin);
+    return end;
 }
 
-void bqPlayerCallback(SLAndroidSimpleBufferQueueItf bq, void *context) {
-    assert(bq == bqPlayerBufferQueue);
-    assert(NULL == context);
-    //对于流式播放，请将此测试替换为逻辑以查找并填充下一个缓冲区
-    if (--nextCount > 0 && nextBuffer != NULL && nextSize) {
-        SLresult result;
-        result = (*bqPlayerBufferQueue)->Enqueue(bqPlayerBufferQueue, nextBuffer, nextSize);
-        if (result != SL_RESULT_SUCCESS) {
-            pthread_mutex_unlock(&audioEngineLock);
-        }
-        UNUSED(result)
-    } else {
-        releaseResampleBuf();
-        pthread_mutex_unlock(&audioEngineLock);
+static NativeEngine *allocEngine(void) {
+    NativeEngine *engine = (NativeEngine *) calloc(1, sizeof(NativeEngine));
+    if (engine == NULL) {
+        return NULL;
+    }
+    engine->startup.begin = callbackStatsNow();
+    engine->core = audioEngineCreate();
+    if (engine->core == NULL) {
+        free(engine);
+        return NULL;
     }
+    engine->recorder.format = RECORD_FORMAT_WAV;
+    pthread_mutex_init(&engine->startup.lock, NULL);
+    pthread_cond_init(&engine->startup.realized, NULL);
+    pthread_mutex_init(&engine->startup.joinLock, NULL);
+    pthread_mutex_init(&engine->playersLock, NULL);
+    return engine;
 }
 
-JNIEXPORT void JNICALL
-Java_com_hzw_nativeaudio_MainActivity_createEngine(JNIEnv *env, jobject thiz) {
+//创建并实例化 OpenSL 引擎对象。引擎对象只能同步实例化，异步实例化要用到它自己的线程池
+static bool createSlEngine(NativeEngine *engine) {
+    uint64_t begin = callbackStatsNow();
     SLresult result;
-
     // slCreateEngine 是 OpenSL ES 中的一个函数，用于创建一个引擎对象.
     // 第一个参数是指向引擎对象的指针，第二个参数是选项数目，第三个参数是选项数组，第四个参数是接口数目，第五个参数是接口数组，第六个参数是接口是否必须的标志数组。
     // 详细介绍：https://juejin.cn/post/7031848037311840293
-    result = slCreateEngine(&engineObject, 0, NULL, 0, NULL, NULL);
-    assert(SL_RESULT_SUCCESS == result);
-    // 在这段代码中，(void) result; 的作用是告诉编译器，我们不需要使用result变量的值，这样可以避免编译器产生未使用变量的警告。
-    // 这种方法比使用ignore_unused更加清晰明了，因为它直接告诉编译器我们不需要使用这个变量的值
-    // 也可以定义宏 #define UNUSED(x) (void)(x);
-    (void) result;
+    result = slCreateEngine(&engine->engineObject, 0, NULL, 0, NULL, NULL);
+    if (SL_RESULT_SUCCESS != result) {
+        engine->engineObject = NULL;
+        return false;
+    }
 
     //实例化一个对象
     //第一个参数是指向对象的指针，第二个参数是异步标志。
-    result = (*engineObject)->Realize(engineObject, SL_BOOLEAN_FALSE);
-    assert(SL_RESULT_SUCCESS == result);
-    UNUSED(result)
+    result = (*engine->engineObject)->Realize(engine->engineObject, SL_BOOLEAN_FALSE);
+    if (SL_RESULT_SUCCESS != result) {
+        return false;
+    }
 
     //获取引擎对象接口
-    result = (*engineObject)->GetInterface(engineObject, SL_IID_ENGINE, &enginEngine);
-    assert(SL_RESULT_SUCCESS == result);
-    UNUSED(result)
-
-    //用于创建一个输出混音器对象, 该对象可以将多个音频流混合到一起并输出到设备的音频输出端口。
-    const SLInterfaceID ids[1] = {SL_IID_ENVIRONMENTALREVERB};
-    const SLboolean req[1] = {SL_BOOLEAN_FALSE};
-    result = (*enginEngine)->CreateOutputMix(enginEngine, &outputMixObject, 1, ids, req);
-    assert(SL_RESULT_SUCCESS == result);
-    UNUSED(result)
-
-    result = (*outputMixObject)->Realize(outputMixObject, SL_BOOLEAN_FALSE);
-    assert(SL_RESULT_SUCCESS == result);
-    UNUSED(result)
+    result = (*engine->engineObject)->GetInterface(engine->engineObject, SL_IID_ENGINE,
+                                                   &engine->enginEngine);
+    if (SL_RESULT_SUCCESS != result) {
+        return false;
+    }
+    startupPhaseEnd(engine, STARTUP_PHASE_ENGINE, begin);
+    return true;
+}
 
-    result = (*outputMixObject)->GetInterface(outputMixObject, SL_IID_ENVIRONMENTALREVERB,
-                                              &outputMixEnvironmentalReverb);
-    if (SL_RESULT_SUCCESS == result) {
-        //用于设置环境混响效果的参数。
-        //它可以设置混响的房间大小、混响的时间、混响的强度等参数，从而实现不同的混响效果
-        result = (*outputMixEnvironmentalReverb)->SetEnvironmentalReverbProperties(
-                outputMixEnvironmentalReverb, &reverbSettings);
-        UNUSED(result)
+//异步实例化完成时在 OpenSL 的线程池里调用，pContext 是引擎上下文
+static void outputMixRealized(SLObjectItf caller, const void *pContext, SLuint32 event,
+                              SLresult result, SLuint32 param, void *pInterface) {
+    NativeEngine *engine = (NativeEngine *) pContext;
+    StartupState *startup = &engine->startup;
+    if (event != SL_OBJECT_EVENT_ASYNC_TERMINATION) {
+        return;
     }
+    pthread_mutex_lock(&startup->lock);
+    startup->outputMixResult = result;
+    startup->outputMixDone = true;
+    startupPhaseEnd(engine, STARTUP_PHASE_OUTPUT_MIX, startup->outputMixBegin);
+    pthread_cond_signal(&startup->realized);
+    pthread_mutex_unlock(&startup->lock);
 }
 
-JNIEXPORT void JNICALL
-Java_com_hzw_nativeaudio_MainActivity_createBufferQueueAudioPlayer(JNIEnv *env, jobject thiz,
-                                                                   jint sampleRate, jint bufSize) {
+//用于创建一个输出混音器对象, 该对象可以将多个音频流混合到一起并输出到设备的音频输出端口。
+//async 时只发起实例化就返回，由 awaitOutputMix 等它完成，期间调用方可以做别的准备工作
+static bool createOutputMix(NativeEngine *engine, bool async) {
+    StartupState *startup = &engine->startup;
     SLresult result;
-    if (sampleRate >= 0 && bufSize >= 0) {
-        bqPlayerSampleRate = sampleRate * 1000;
-        //设备本机缓冲区大小是最小化音频延迟的另一个因素，此示例中未使用：我们在这里只播放一个巨大的缓冲区
-        bqPlayerBufSize = bufSize;
+    startup->outputMixBegin = callbackStatsNow();
+    //不再请求 SL_IID_ENVIRONMENTALREVERB：送到它需要播放器带 SL_IID_EFFECTSEND，那样就没有快速音频，
+    //混响改由引擎在混音总线上完成
+    result = (*engine->enginEngine)->CreateOutputMix(engine->enginEngine, &engine->outputMixObject,
+                                                     0, NULL, NULL);
+    if (SL_RESULT_SUCCESS != result) {
+        engine->outputMixObject = NULL;
+        return false;
     }
+    if (async) {
+        result = (*engine->outputMixObject)->RegisterCallback(engine->outputMixObject,
+                                                              outputMixRealized, engine);
+        if (SL_RESULT_SUCCESS == result) {
+            result = (*engine->outputMixObject)->Realize(engine->outputMixObject, SL_BOOLEAN_TRUE);
+        }
+        return SL_RESULT_SUCCESS == result;
+    }
+    result = (*engine->outputMixObject)->Realize(engine->outputMixObject, SL_BOOLEAN_FALSE);
+    startup->outputMixDone = true;
+    startup->outputMixResult = result;
+    startupPhaseEnd(engine, STARTUP_PHASE_OUTPUT_MIX, startup->outputMixBegin);
+    return SL_RESULT_SUCCESS == result;
+}
 
-    //配置音频源
-    SLDataLocator_AndroidSimpleBufferQueue loc_bufq = {
-            SL_DATALOCATOR_ANDROIDSIMPLEBUFFERQUEUE, 2
-    };
+static bool awaitOutputMix(NativeEngine *engine) {
+    StartupState *startup = &engine->startup;
+    pthread_mutex_lock(&startup->lock);
+    while (!startup->outputMixDone) {
+        pthread_cond_wait(&startup->realized, &startup->lock);
+    }
+    bool realized = startup->outputMixResult == SL_RESULT_SUCCESS;
+    pthread_mutex_unlock(&startup->lock);
+    if (realized) {
+        playerPoolInit(&engine->players, engine->enginEngine, engine->outputMixObject);
+    }
+    return realized;
+}
 
-    SLDataFormat_PCM format_pcm = {
-            SL_DATAFORMAT_PCM, 1,
-            SL_SAMPLINGRATE_8, SL_PCMSAMPLEFORMAT_FIXED_16,
-            SL_PCMSAMPLEFORMAT_FIXED_16, SL_SPEAKER_FRONT_CENTER,
-            SL_BYTEORDER_LITTLEENDIAN
-    };
+static unsigned outputRateOf(NativeEngine *engine) {
+    //输出采样率：拿到设备本机采样率时用它，否则缓冲区队列播放器以 8 kHz 创建
+    return engine->bqPlayerSampleRate ? engine->bqPlayerSampleRate / 1000
+                                      : SL_SAMPLINGRATE_8 / 1000;
+}
+
+static unsigned burstFramesOf(NativeEngine *engine) {
+    return engine->bqPlayerBufSize > 0 ? (unsigned) engine->bqPlayerBufSize
+                                       : DEFAULT_BURST_FRAMES;
+}
+
+//引擎核心的准备只是内存分配和表格计算，不依赖 OpenSL 对象，异步启动时和输出混音器的实例化重叠
+static bool initCore(NativeEngine *engine) {
+    uint64_t begin = callbackStatsNow();
+    bool ready = audioEngineInit(engine->core, outputRateOf(engine), burstFramesOf(engine));
+    startupPhaseEnd(engine, STARTUP_PHASE_CORE, begin);
+    return ready;
+}
 
-    //尽可能启用快速音频：一旦我们将相同的速率设置为本机，将触发快速音频路径
-    if (bqPlayerSampleRate) {
-        format_pcm.samplesPerSec = bqPlayerSampleRate;
+//创建缓冲区队列播放器并开始播放，需要输出混音器和引擎核心都已就绪
+static bool startPlayer(NativeEngine *engine) {
+    uint64_t begin = callbackStatsNow();
+    unsigned outputRate = outputRateOf(engine);
+    unsigned burstFrames = burstFramesOf(engine);
+    //能送 float 时就不在这里量化，由系统混音器直接接收 float；否则引擎输出带抖动的 int16
+    engine->bqPlayerBackend = audioBackendCreateOpenSL(engine->enginEngine,
+                                                       engine->outputMixObject,
+                                                       engine->bqPlayerSampleRate, burstFrames,
+                                                       AUDIO_FORMAT_FLOAT, audioEngineRender,
+                                                       engine->core);
+    if (engine->bqPlayerBackend == NULL) {
+        return false;
     }
-    SLDataSource audioSrc = {
-            &loc_bufq, &format_pcm
-    };
-    //配置音频接收器
-    SLDataLocator_OutputMix loc_outmix = {
-            SL_DATALOCATOR_OUTPUTMIX, outputMixObject
-    };
-    SLDataSink audioSnk = {
-            &loc_outmix, NULL
-    };
+    callbackStatsInit(&engine->playerStats, (uint64_t) burstFrames * 1000000000u / outputRate);
+    engine->bqPlayerBackend->stats = &engine->playerStats;
 
-    //创建音频播放器：快速音频在需要SL_IID_EFFECTSEND时不支持，跳过它以获得快速音频案例
-    const SLInterfaceID ids[3] = {
-            SL_IID_BUFFERQUEUE, SL_IID_VOLUME, SL_IID_EFFECTSEND,
-    };
-    const SLboolean req[3] = {SL_BOOLEAN_TRUE, SL_BOOLEAN_TRUE, SL_BOOLEAN_TRUE,};
+    //流从这里开始就一直运行，选择剪辑只需要向引擎发一条命令
+    if (!audioBackendStart(engine->bqPlayerBackend)) {
+        return false;
+    }
+    engine->startup.playerStarted = startupPhaseEnd(engine, STARTUP_PHASE_PLAYER, begin);
+    return true;
+}
 
-    result = (*enginEngine)->CreateAudioPlayer(enginEngine, &bqPlayerObject, &audioSrc, &audioSnk,
-                                               bqPlayerSampleRate ? 2 : 3, ids, req);
-    assert(SL_RESULT_SUCCESS == result);
-    UNUSED(result)
+//停止并销毁缓冲区队列播放器。OpenSL 的 Destroy 等正在运行的回调返回，之后音频回调不会再运行
+static void destroyPlayer(NativeEngine *engine) {
+    if (engine->bqPlayerBackend != NULL) {
+        audioBackendStop(engine->bqPlayerBackend);
+        audioBackendDestroy(engine->bqPlayerBackend);
+        engine->bqPlayerBackend = NULL;
+    }
+}
 
-    result = (*bqPlayerObject)->Realize(bqPlayerObject, SL_BOOLEAN_FALSE);
-    assert(SL_RESULT_SUCCESS == result);
-    UNUSED(result)
+static void setPlayerFormat(NativeEngine *engine, jint sampleRate, jint bufSize) {
+    if (sampleRate >= 0 && bufSize >= 0) {
+        engine->bqPlayerSampleRate = sampleRate * 1000;
+        //设备本机缓冲区大小是最小化音频延迟的另一个因素：每个流式缓冲区恰好是一个突发
+        engine->bqPlayerBufSize = bufSize;
+    }
+}
 
-    result = (*bqPlayerObject)->GetInterface(bqPlayerObject, SL_IID_PLAY, &bqPlayerPlay);
-    assert(SL_RESULT_SUCCESS == result);
-    UNUSED(result)
+//返回引擎上下文的句柄，之后的 JNI 调用都要带上它，用完交给 shutdown 释放。内存不足时返回 0
+JNIEXPORT jlong JNICALL
+Java_com_hzw_nativeaudio_MainActivity_createEngine(JNIEnv *env, jobject thiz) {
+    NativeEngine *engine = allocEngine();
+    if (engine == NULL) {
+        return 0;
+    }
+    bool created = createSlEngine(engine) && createOutputMix(engine, false) &&
+                   awaitOutputMix(engine);
+    assert(created);
+    UNUSED(created)
+    return (jlong) (intptr_t) engine;
+}
 
-    result = (*bqPlayerObject)->GetInterface(bqPlayerObject, SL_IID_BUFFERQUEUE,
-                                             &bqPlayerBufferQueue);
-    assert(SL_RESULT_SUCCESS == result);
-    UNUSED(result)
+JNIEXPORT void JNICALL
+Java_com_hzw_nativeaudio_MainActivity_createBufferQueueAudioPlayer(JNIEnv *env, jobject thiz,
+                                                                   jlong handle, jint sampleRate,
+                                                                   jint bufSize) {
+    NativeEngine *engine = fromHandle(handle);
+    //换采样率重新创建时旧播放器的回调还在读引擎的缓冲区，audioEngineInit 之前先销毁它
+    destroyPlayer(engine);
+    setPlayerFormat(engine, sampleRate, bufSize);
+    bool engineReady = initCore(engine);
+    assert(engineReady);
+    UNUSED(engineReady)
+    bool started = startPlayer(engine);
+    assert(started);
+    UNUSED(started)
+    engine->startup.ok = started;
+    atomic_store_explicit(&engine->startup.done, true, memory_order_release);
+}
 
-    result = (*bqPlayerBufferQueue)->RegisterCallback(bqPlayerBufferQueue, bqPlayerCallback, NULL);
-    assert(SL_RESULT_SUCCESS == result);
-    UNUSED(result)
+//后台启动线程：引擎对象必须先实例化；输出混音器在 OpenSL 的线程池里异步实例化，
+//同时在这里准备引擎核心，两者都好了再创建并启动缓冲区队列播放器
+static void *startupThread(void *arg) {
+    NativeEngine *engine = (NativeEngine *) arg;
+    bool ok = createSlEngine(engine);
+    bool mixPending = ok && createOutputMix(engine, true);
+    bool coreReady = initCore(engine);
+    //发起了异步实例化就一定要等它结束，之后才能销毁输出混音器
+    ok = mixPending && awaitOutputMix(engine);
+    engine->startup.ok = ok && coreReady && startPlayer(engine);
+    atomic_store_explicit(&engine->startup.done, true, memory_order_release);
+    return NULL;
+}
 
-    bqPlayerEffectSend = NULL;
-    if (bqPlayerSampleRate == 0) {
-        result = (*bqPlayerObject)->GetInterface(bqPlayerObject, SL_IID_EFFECTSEND, &bqPlayerEffectSend);
-        assert(SL_RESULT_SUCCESS == result);
-        UNUSED(result)
+//createEngine 加 createBufferQueueAudioPlayer 的异步版本：立即返回句柄，OpenSL 对象的实例化和
+//引擎核心的准备在后台线程里重叠进行，调用方可以同时加载界面。使用句柄前先调用 awaitEngine
+JNIEXPORT jlong JNICALL
+Java_com_hzw_nativeaudio_MainActivity_createEngineAsync(JNIEnv *env, jobject thiz,
+                                                        jint sampleRate, jint bufSize) {
+    NativeEngine *engine = allocEngine();
+    if (engine == NULL) {
+        return 0;
     }
+    setPlayerFormat(engine, sampleRate, bufSize);
+    if (pthread_create(&engine->startup.thread, NULL, startupThread, engine) != 0) {
+        //起不了线程就在当前线程里按同样的顺序完成
+        startupThread(engine);
+    } else {
+        engine->startup.threadRunning = true;
+    }
+    return (jlong) (intptr_t) engine;
+}
 
-#if 0  \
-    // 已知为单声道的源不支持mutesolo，因为这是获取mutesolo接口
-    result = (*bqPlayerObject)->GetInterface(bqPlayerObject, SL_IID_MUTESOLO, &bqPlayerMuteSolo);
-    assert(SL_RESULT_SUCCESS == result);
-    (void)result;
-#endif
+//等后台启动结束，返回播放器是否已经在运行。可以重复调用，也可以在多个线程里同时调用
+JNIEXPORT jboolean JNICALL
+Java_com_hzw_nativeaudio_MainActivity_awaitEngine(JNIEnv *env, jobject thiz, jlong handle) {
+    NativeEngine *engine = fromHandle(handle);
+    pthread_mutex_lock(&engine->startup.joinLock);
+    if (engine->startup.threadRunning) {
+        pthread_join(engine->startup.thread, NULL);
+        engine->startup.threadRunning = false;
+    }
+    pthread_mutex_unlock(&engine->startup.joinLock);
+    return engine->startup.ok;
+}
 
-    result = (*bqPlayerObject)->GetInterface(bqPlayerObject, SL_IID_VOLUME, &bqPlayerVolume);
-    assert(SL_RESULT_SUCCESS == result);
-    UNUSED(result)
+//各启动阶段的耗时（纳秒），下标见 StartupPhase；启动结束前全部为 0，还没到的阶段为 0。
+//第一个回调说明第一个突发已经播出，TOTAL 是从创建上下文到那时的冷启动时间。不用等 awaitEngine
+JNIEXPORT jlongArray JNICALL
+Java_com_hzw_nativeaudio_MainActivity_getStartupTimings(JNIEnv *env, jobject thiz,
+                                                        jlong handle) {
+    NativeEngine *engine = fromHandle(handle);
+    jlong values[STARTUP_PHASES] = {0};
+    bool done = atomic_load_explicit(&engine->startup.done, memory_order_acquire);
+    if (done) {
+        memcpy(values, engine->startup.phases, sizeof(values));
+    }
+    int64_t stats[CALLBACK_STATS_FIELDS];
+    if (done && engine->startup.playerStarted != 0 &&
+        callbackStatsSnapshot(&engine->playerStats, stats) &&
+        stats[CALLBACK_STATS_FIRST_ARRIVAL_NS] != 0) {
+        uint64_t first = (uint64_t) stats[CALLBACK_STATS_FIRST_ARRIVAL_NS];
+        values[STARTUP_PHASE_FIRST_CALLBACK] = (jlong) (first - engine->startup.playerStarted);
+        values[STARTUP_PHASE_TOTAL] = (jlong) (first - engine->startup.begin);
+    }
+    jlongArray array = (*env)->NewLongArray(env, STARTUP_PHASES);
+    if (array != NULL) {
+        (*env)->SetLongArrayRegion(env, array, 0, STARTUP_PHASES, values);
+    }
+    return array;
+}
 
-    // 将玩家的状态设置为正在播放
-    result = (*bqPlayerPlay)->SetPlayState(bqPlayerPlay, SL_PLAYSTATE_PLAYING);
-    assert(SL_RESULT_SUCCESS == result);
-    UNUSED(result)
+//停止映射资源的声部，等音频回调交还引用后解除映射
+static void releaseAssetWav(NativeEngine *engine) {
+    AssetPlayer *asset = &engine->asset;
+    if (!asset->wavMapped) {
+        return;
+    }
+    const struct timespec poll = {0, 1000 * 1000};
+    if (audioEngineStopPcm(engine->core, &asset->wav.refs)) {
+        while (atomic_load_explicit(&asset->wav.refs, memory_order_acquire) != 0) {
+            nanosleep(&poll, NULL);
+        }
+    }
+    mappedWavUnmap(&asset->wav);
+    asset->wavMapped = false;
+}
+
+//把当前的资源播放器交还：映射的 WAV 解除映射，解码的资源停止播放（PCM 留在缓存里），fd 播放器放回池里
+static void releaseAssetPlayer(NativeEngine *engine) {
+    releaseAssetWav(engine);
+    if (engine->asset.decoded != NULL) {
+        audioEngineStopAsset(engine->core, engine->asset.decoded);
+        free(engine->asset.decoded);
+        engine->asset.decoded = NULL;
+    }
+    if (engine->asset.fd != NULL) {
+        playerPoolPut(&engine->players, engine->asset.fd);
+        engine->asset.fd = NULL;
+    }
+}
+
+//签出资源的播放方式，依次尝试：
+//已经在解码缓存里的资源，*decoded 置为 true 并返回 NULL；池里 name 的空闲 fd 播放器；
+//16 位单声道 WAV 映射进 wav，*mapped 置为 true 并返回 NULL；WAV 和 MediaCodec 能解码的资源
+//渐进解码进引擎的缓存（第一块解码完就返回），*decoded 置为 true 并返回 NULL，
+//立体声保留两个声道，声道静音/独奏由引擎处理；最后才创建一个新的 fd 播放器，文件描述符交给池管理
+static SlPlayer *checkOutAsset(NativeEngine *engine, AAssetManager *mgr, const char *name,
+                               MappedWav *wav, bool *mapped, bool *decoded) {
+    static const AudioDecoderOpenFn decoders[] = {audioDecoderOpenWav,
+                                                  audioDecoderOpenMediaCodec};
+    *mapped = false;
+    *decoded = audioEngineHasAsset(engine->core, name);
+    if (*decoded) {
+        return NULL;
+    }
+    SlPlayer *player = playerPoolAcquire(&engine->players, PLAYER_SOURCE_FD, name);
+    if (player != NULL) {
+        return player;
+    }
+    AAsset *file = AAssetManager_open(mgr, name, AASSET_MODE_UNKNOWN);
+    if (file == NULL) {
+        return NULL;
+    }
+    off_t start, length;
+    //压缩存放在 APK 里的资源没有文件描述符
+    int fd = AAsset_openFileDescriptor(file, &start, &length);
+    AAsset_close(file);
+    if (fd < 0) {
+        return NULL;
+    }
+    if (mappedWavMapFd(wav, fd, start, length, 0)) {
+        //映射不依赖 fd，播放从此不经过文件描述符
+        close(fd);
+        *mapped = true;
+        return NULL;
+    }
+    AudioDecoderSource source = {fd, start, length, 0};
+    AudioDecoder *decoder = audioDecoderOpen(&source, decoders,
+                                             sizeof(decoders) / sizeof(decoders[0]));
+    //解码器自己 dup 了 fd
+    if (decoder != NULL && audioEngineLoadAsset(engine->core, name, decoder, true)) {
+        close(fd);
+        *decoded = true;
+        return NULL;
+    }
+    return playerPoolCreateFd(&engine->players, name, fd, start, length);
 }
 
 JNIEXPORT jboolean JNICALL
 Java_com_hzw_nativeaudio_MainActivity_createAssetAudioPlayer(JNIEnv *env, jobject thiz,
-                                                             jobject assetManager,
+                                                             jlong handle, jobject assetManager,
                                                              jstring filename) {
+    NativeEngine *engine = fromHandle(handle);
+    AssetPlayer *asset = &engine->asset;
     SLresult result;
     const char *utf8 = (*env)->GetStringUTFChars(env, filename, NULL);
     assert(utf8 != NULL);
 
     AAssetManager *mgr = AAssetManager_fromJava(env, assetManager);
     assert(mgr != NULL);
-    AAsset *asset = AAssetManager_open(mgr, utf8, AASSET_MODE_UNKNOWN);
+    pthread_mutex_lock(&engine->playersLock);
+    releaseAssetPlayer(engine);
+    bool mapped, decoded;
+    SlPlayer *player = checkOutAsset(engine, mgr, utf8, &asset->wav, &mapped, &decoded);
+    pthread_mutex_unlock(&engine->playersLock);
+    if (decoded) {
+        asset->decoded = strdup(utf8);
+    }
     (*env)->ReleaseStringUTFChars(env, filename, utf8);
 
-    if (asset == NULL) {
+    if (mapped) {
+        asset->wavMapped = true;
+        return JNI_TRUE;
+    }
+    if (decoded) {
+        return asset->decoded != NULL;
+    }
+    if (player == NULL) {
         return JNI_FALSE;
     }
 
-    off_t start, length;
-    int fd = AAsset_openFileDescriptor(asset, &start, &length);
-    assert(0 <= fd);
-    AAsset_close(asset);
-
-
-    // 配置音频源
-    SLDataLocator_AndroidFD loc_fd = {SL_DATALOCATOR_ANDROIDFD, fd, start, length};
-    SLDataFormat_MIME format_mime = {SL_DATAFORMAT_MIME, NULL, SL_CONTAINERTYPE_UNSPECIFIED};
-    SLDataSource audioSrc = {&loc_fd, &format_mime};
-    // 配置音频接收器
-    SLDataLocator_OutputMix loc_outmix = {SL_DATALOCATOR_OUTPUTMIX, outputMixObject};
-    SLDataSink audioSnk = {&loc_outmix, NULL};
-
-    // 创建音频播放器
-    const SLInterfaceID ids[3] = {SL_IID_SEEK, SL_IID_MUTESOLO, SL_IID_VOLUME};
-    const SLboolean req[3] = {SL_BOOLEAN_TRUE, SL_BOOLEAN_TRUE, SL_BOOLEAN_TRUE};
-    result = (*enginEngine)->CreateAudioPlayer(enginEngine, &fdPlayerObject, &audioSrc, &audioSnk,
-                                               3, ids, req);
-    assert(SL_RESULT_SUCCESS == result);
-    UNUSED(result)
-
-    // 实例化播放器
-    result = (*fdPlayerObject)->Realize(fdPlayerObject, SL_BOOLEAN_FALSE);
-    assert(SL_RESULT_SUCCESS == result);
-    UNUSED(result)
-
-    // 获取播放器接口
-    result = (*fdPlayerObject)->GetInterface(fdPlayerObject, SL_IID_PLAY, &fdPlayerPlay);
-    assert(SL_RESULT_SUCCESS == result);
-    UNUSED(result)
-
-    // 获取Seek接口
-    result = (*fdPlayerObject)->GetInterface(fdPlayerObject, SL_IID_SEEK, &fdPlayerSeek);
-    assert(SL_RESULT_SUCCESS == result);
-    UNUSED(result)
-
-    // 获取静音接口
-    result = (*fdPlayerObject)->GetInterface(fdPlayerObject, SL_IID_MUTESOLO, &fdPlayerMuteSolo);
-    assert(SL_RESULT_SUCCESS == result);
-    UNUSED(result)
-
-    // 获取音量接口
-    result = (*fdPlayerObject)->GetInterface(fdPlayerObject, SL_IID_VOLUME, &fdPlayerVolume);
-    assert(SL_RESULT_SUCCESS == result);
-    UNUSED(result)
-
     // 启用整个文件循环
-    result = (*fdPlayerSeek)->SetLoop(fdPlayerSeek, SL_BOOLEAN_TRUE, 0, SL_TIME_UNKNOWN);
+    result = (*player->seek)->SetLoop(player->seek, SL_BOOLEAN_TRUE, 0, SL_TIME_UNKNOWN);
     assert(SL_RESULT_SUCCESS == result);
     UNUSED(result)
 
+    asset->fd = player;
     return JNI_TRUE;
 }
 
+//预先把资源解码进缓存（后台继续解码）或者创建 fd 播放器放进池里，之后 createAssetAudioPlayer 只需要签出它；
+//映射播放的 WAV 不需要准备。可以在后台线程里调用，避免解码和实例化占用界面线程
+JNIEXPORT jboolean JNICALL
+Java_com_hzw_nativeaudio_MainActivity_preloadAssetAudioPlayer(JNIEnv *env, jobject thiz,
+                                                              jlong handle, jobject assetManager,
+                                                              jstring filename) {
+    NativeEngine *engine = fromHandle(handle);
+    const char *utf8 = (*env)->GetStringUTFChars(env, filename, NULL);
+    if (utf8 == NULL) {
+        return JNI_FALSE;
+    }
+    AAssetManager *mgr = AAssetManager_fromJava(env, assetManager);
+    MappedWav probe;
+    bool mapped, decoded;
+    pthread_mutex_lock(&engine->playersLock);
+    SlPlayer *player = checkOutAsset(engine, mgr, utf8, &probe, &mapped, &decoded);
+    if (player != NULL) {
+        playerPoolPut(&engine->players, player);
+    }
+    pthread_mutex_unlock(&engine->playersLock);
+    (*env)->ReleaseStringUTFChars(env, filename, utf8);
+
+    if (mapped) {
+        mappedWavUnmap(&probe);
+    }
+    return mapped || decoded || player != NULL;
+}
+
 JNIEXPORT void JNICALL
 Java_com_hzw_nativeaudio_MainActivity_setPlayingAssetAudioPlayer(JNIEnv *env, jobject thiz,
-                                                                 jboolean isPlaying) {
+                                                                 jlong handle, jboolean isPlaying) {
+    NativeEngine *engine = fromHandle(handle);
+    AssetPlayer *asset = &engine->asset;
     SLresult result;
 
+    //映射的资源和 fd 播放器一样整段循环；暂停就是停掉声部，再播放时从头开始
+    if (asset->wavMapped) {
+        audioEngineStopPcm(engine->core, &asset->wav.refs);
+        if (isPlaying) {
+            audioEnginePlayPcm(engine->core, asset->wav.pcm, asset->wav.frames,
+                               asset->wav.sampleRate, INT_MAX, &asset->wav.refs);
+        }
+        return;
+    }
+    if (asset->decoded != NULL) {
+        audioEngineStopAsset(engine->core, asset->decoded);
+        if (isPlaying) {
+            audioEnginePlayAsset(engine->core, asset->decoded, INT_MAX);
+        }
+        return;
+    }
+
     // 确保Asset音频播放器已创建
-    if (NULL != fdPlayerPlay) {
+    if (NULL != asset->fd) {
         // 设置播放器播放和暂停状态
-        result = (*fdPlayerPlay)->SetPlayState(fdPlayerPlay, isPlaying ? SL_PLAYSTATE_PLAYING
-                                                                       : SL_PLAYSTATE_PAUSED);
+        result = (*asset->fd->play)->SetPlayState(asset->fd->play, isPlaying ? SL_PLAYSTATE_PLAYING
+                                                                             : SL_PLAYSTATE_PAUSED);
         assert(SL_RESULT_SUCCESS == result);
         UNUSED(result)
     }
 }
 
 JNIEXPORT jboolean JNICALL
-Java_com_hzw_nativeaudio_MainActivity_createUriAudioPlayer(JNIEnv *env, jobject thiz, jstring uri) {
-    SLresult result;
+Java_com_hzw_nativeaudio_MainActivity_createUriAudioPlayer(JNIEnv *env, jobject thiz, jlong handle,
+                                                           jstring uri) {
+    NativeEngine *engine = fromHandle(handle);
 
     // 将 Java 字符串转换为 UTF-8
     const char *utf8 = (*env)->GetStringUTFChars(env, uri, NULL);
     assert(NULL != utf8);
 
-    // 配置音频源 需要网络访问权限
-    SLDataLocator_URI loc_uri = {SL_DATALOCATOR_URI, (SLchar *) utf8};
-    SLDataFormat_MIME format_mime = {SL_DATAFORMAT_MIME, NULL, SL_CONTAINERTYPE_UNSPECIFIED};
-    SLDataSource audioSrc = {&loc_uri, &format_mime};
-
-    // 配置音频接收器
-    SLDataLocator_OutputMix loc_outmix = {SL_DATALOCATOR_OUTPUTMIX, outputMixObject};
-    SLDataSink audioSnk = {&loc_outmix, NULL};
-
-    // 创建音频播放器
-    const SLInterfaceID ids[3] = {SL_IID_SEEK, SL_IID_MUTESOLO, SL_IID_VOLUME};
-    const SLboolean req[3] = {SL_BOOLEAN_TRUE, SL_BOOLEAN_TRUE, SL_BOOLEAN_TRUE};
-    result = (*enginEngine)->CreateAudioPlayer(enginEngine, &uriPlayerObject, &audioSrc, &audioSnk,
-                                               3, ids, req);
-    // 请注意，此处未检测到无效的 URI，但在 Android 上的准备预取期间，或者可能在其他平台上的实现期间检测到无效的 URI。
-    assert(SL_RESULT_SUCCESS == result);
-    UNUSED(result)
+    //旧的播放器放回池里；同一个 URI 之前用过时直接签出，不用重新创建和实例化
+    pthread_mutex_lock(&engine->playersLock);
+    if (engine->uri != NULL) {
+        playerPoolPut(&engine->players, engine->uri);
+        engine->uri = NULL;
+    }
+    SlPlayer *player = playerPoolAcquire(&engine->players, PLAYER_SOURCE_URI, utf8);
+    if (player == NULL) {
+        // 请注意，此处未检测到无效的 URI，但在 Android 上的准备预取期间，或者可能在其他平台上的实现期间检测到无效的 URI。
+        player = playerPoolCreateUri(&engine->players, utf8);
+    }
+    pthread_mutex_unlock(&engine->playersLock);
 
     // 释放 Java 字符串和 UTF-8
     (*env)->ReleaseStringUTFChars(env, uri, utf8);
 
-    // 实例化播放器对象
-    result = (*uriPlayerObject)->Realize(uriPlayerObject, SL_BOOLEAN_FALSE);
-    // 这在 Android 上总是会成功，但我们检查结果是否可以移植到其他平台
-    if (SL_RESULT_SUCCESS != result) {
-        (*uriPlayerObject)->Destroy(uriPlayerObject);
-        uriPlayerObject = NULL;
+    if (player == NULL) {
         return JNI_FALSE;
     }
-
-    // 获取播放器接口
-    result = (*uriPlayerObject)->GetInterface(uriPlayerObject, SL_IID_PLAY, &uriPlayerPlay);
-    assert(SL_RESULT_SUCCESS == result);
-    UNUSED(result)
-
-    // 获取Seek接口
-    result = (*uriPlayerObject)->GetInterface(uriPlayerObject, SL_IID_SEEK, &uriPlayerSeek);
-    assert(SL_RESULT_SUCCESS == result);
-    UNUSED(result)
-
-    // 获取静音接口
-    result = (*uriPlayerObject)->GetInterface(uriPlayerObject, SL_IID_MUTESOLO, &uriPlayerMuteSolo);
-    assert(SL_RESULT_SUCCESS == result);
-    UNUSED(result)
-
-    // 获取音量接口
-    result = (*uriPlayerObject)->GetInterface(uriPlayerObject, SL_IID_VOLUME, &uriPlayerVolume);
-    assert(SL_RESULT_SUCCESS == result);
-    UNUSED(result)
-
+    engine->uri = player;
     return JNI_TRUE;
 }
 
@@ -423,63 +677,76 @@ void checkResult(SLresult *result) {
 
 JNIEXPORT void JNICALL
 Java_com_hzw_nativeaudio_MainActivity_setPlayingUriAudioPlayer(JNIEnv *env, jobject thiz,
-                                                               jboolean isPlaying) {
+                                                               jlong handle, jboolean isPlaying) {
+    SlPlayer *uri = fromHandle(handle)->uri;
     SLresult result;
-    if (uriPlayerPlay != NULL) {
-        result = (*uriPlayerPlay)->SetPlayState(uriPlayerPlay, isPlaying ? SL_PLAYSTATE_PLAYING
-                                                                         : SL_PLAYSTATE_PAUSED);
+    if (uri != NULL) {
+        result = (*uri->play)->SetPlayState(uri->play, isPlaying ? SL_PLAYSTATE_PLAYING
+                                                                 : SL_PLAYSTATE_PAUSED);
         checkResult(&result);
     }
 }
 
 JNIEXPORT void JNICALL
 Java_com_hzw_nativeaudio_MainActivity_setLoopingUriAudioPlayer(JNIEnv *env, jobject thiz,
-                                                               jboolean isLooping) {
+                                                               jlong handle, jboolean isLooping) {
+    SlPlayer *uri = fromHandle(handle)->uri;
     SLresult result;
-    if (uriPlayerPlay != NULL) {
-        result = (*uriPlayerSeek)->SetLoop(uriPlayerSeek, (SLboolean) isLooping, 0,
-                                           SL_TIME_UNKNOWN);
+    if (uri != NULL) {
+        result = (*uri->seek)->SetLoop(uri->seek, (SLboolean) isLooping, 0, SL_TIME_UNKNOWN);
         checkResult(&result);
     }
 }
 
-static SLMuteSoloItf getMuteSolo() {
-    if (uriPlayerMuteSolo != NULL) {
-        return uriPlayerMuteSolo;
-    } else if (fdPlayerMuteSolo != NULL) {
-        return fdPlayerMuteSolo;
+//缓冲区队列播放器在 backend_opensl 里创建，没有请求 SL_IID_MUTESOLO；
+//返回 NULL 时引擎里的资源由引擎按声道静音/独奏
+static SLMuteSoloItf getMuteSolo(NativeEngine *engine) {
+    if (engine->uri != NULL) {
+        return engine->uri->muteSolo;
+    } else if (engine->asset.fd != NULL) {
+        return engine->asset.fd->muteSolo;
     } else {
-        return bqPlayerMuteSolo;
+        return NULL;
     }
 }
 
 JNIEXPORT void JNICALL
 Java_com_hzw_nativeaudio_MainActivity_setChannelMuteUriAudioPlayer(JNIEnv *env, jobject thiz,
-                                                                   jint chan, jboolean mute) {
+                                                                   jlong handle, jint chan,
+                                                                   jboolean mute) {
     SLresult result;
-    SLMuteSoloItf muteSolo = getMuteSolo();
+    NativeEngine *engine = fromHandle(handle);
+    SLMuteSoloItf muteSolo = getMuteSolo(engine);
     if (muteSolo != NULL) {
         result = (*muteSolo)->SetChannelMute(muteSolo, chan, mute);
         checkResult(&result);
+    } else if (chan >= 0) {
+        audioEngineSetChannelMute(engine->core, (unsigned) chan, mute);
     }
 }
 
 JNIEXPORT void JNICALL
 Java_com_hzw_nativeaudio_MainActivity_setChannelSoloUriAudioPlayer(JNIEnv *env, jobject thiz,
-                                                                   jint chan, jboolean solo) {
+                                                                   jlong handle, jint chan,
+                                                                   jboolean solo) {
     SLresult result;
-    SLMuteSoloItf muteSolo = getMuteSolo();
+    NativeEngine *engine = fromHandle(handle);
+    SLMuteSoloItf muteSolo = getMuteSolo(engine);
     if (muteSolo != NULL) {
         result = (*muteSolo)->SetChannelSolo(muteSolo, chan, solo);
         checkResult(&result);
+    } else if (chan >= 0) {
+        audioEngineSetChannelSolo(engine->core, (unsigned) chan, solo);
     }
 }
 
 JNIEXPORT jint JNICALL
-Java_com_hzw_nativeaudio_MainActivity_getNumChannelsUriAudioPlayer(JNIEnv *env, jobject thiz) {
+Java_com_hzw_nativeaudio_MainActivity_getNumChannelsUriAudioPlayer(JNIEnv *env, jobject thiz,
+                                                                   jlong handle) {
+    NativeEngine *engine = fromHandle(handle);
     SLuint8 numChannels;
     SLresult result;
-    SLMuteSoloItf muteSolo = getMuteSolo();
+    SLMuteSoloItf muteSolo = getMuteSolo(engine);
     if (muteSolo != NULL) {
         result = (*muteSolo)->GetNumChannels(muteSolo, &numChannels);
         if (result == SL_RESULT_PRECONDITIONS_VIOLATED) {
@@ -487,216 +754,223 @@ Java_com_hzw_nativeaudio_MainActivity_getNumChannelsUriAudioPlayer(JNIEnv *env,
         } else {
             assert(result == SL_RESULT_SUCCESS);
         }
+    } else if (engine->asset.decoded != NULL) {
+        numChannels = (SLuint8) audioEngineAssetChannels(engine->core, engine->asset.decoded);
+    } else if (engine->asset.wavMapped) {
+        numChannels = 1;
     } else {
         numChannels = 0;
     }
     return numChannels;
 }
 
-static SLVolumeItf getVolume() {
-    if (uriPlayerVolume != NULL) {
-        return uriPlayerVolume;
-    } else if (fdPlayerVolume != NULL) {
-        return fdPlayerVolume;
+//只有 URI 播放器和既不能映射也不能解码的资源播放器还由 OpenSL 处理音量，返回 NULL 时由引擎处理：
+//引擎在样本上按过渡时间平滑地改变增益和声像，不会有 SLVolumeItf 那样的阶跃
+static SLVolumeItf getVolume(NativeEngine *engine) {
+    if (engine->uri != NULL) {
+        return engine->uri->volume;
+    } else if (engine->asset.fd != NULL) {
+        return engine->asset.fd->volume;
     } else {
-        return bqPlayerVolume;
+        return NULL;
+    }
+}
+
+//映射的和解码进缓存的资源都在 PCM 组里播放
+static bool assetInEngine(NativeEngine *engine) {
+    return engine->asset.wavMapped || engine->asset.decoded != NULL;
+}
+
+//引擎里的资源播放时调节只作用在 PCM 组上；否则作用在引擎的整个输出上
+static void engineSetVolume(NativeEngine *engine, int millibel) {
+    if (assetInEngine(engine)) {
+        audioEngineSetGroupVolume(engine->core, VOICE_GROUP_PCM, millibel);
+    } else {
+        audioEngineSetVolume(engine->core, millibel);
+    }
+}
+
+static void engineSetMute(NativeEngine *engine, bool mute) {
+    if (assetInEngine(engine)) {
+        audioEngineSetGroupMute(engine->core, VOICE_GROUP_PCM, mute);
+    } else {
+        audioEngineSetMute(engine->core, mute);
+    }
+}
+
+static void engineApplyStereoPosition(NativeEngine *engine) {
+    int permille = engine->stereoEnabled ? engine->stereoPermille : 0;
+    if (assetInEngine(engine)) {
+        audioEngineSetGroupPan(engine->core, VOICE_GROUP_PCM, permille);
+    } else {
+        audioEngineSetPan(engine->core, permille);
     }
 }
 
 JNIEXPORT void JNICALL
 Java_com_hzw_nativeaudio_MainActivity_setVolumeUriAudioPlayer(JNIEnv *env, jobject thiz,
-                                                              jint millibel) {
+                                                              jlong handle, jint millibel) {
+    NativeEngine *engine = fromHandle(handle);
     SLresult result;
-    SLVolumeItf volume = getVolume();
+    SLVolumeItf volume = getVolume(engine);
     if (volume != NULL) {
         result = (*volume)->SetVolumeLevel(volume, millibel);
         checkResult(&result);
+    } else {
+        engineSetVolume(engine, millibel);
     }
 }
 
 JNIEXPORT void JNICALL
 Java_com_hzw_nativeaudio_MainActivity_setMuteUriAudioPlayer(JNIEnv *env, jobject thiz,
-                                                            jboolean mute) {
+                                                            jlong handle, jboolean mute) {
+    NativeEngine *engine = fromHandle(handle);
     SLresult result;
-    SLVolumeItf volume = getVolume();
+    SLVolumeItf volume = getVolume(engine);
     if (volume != NULL) {
         result = (*volume)->SetMute(volume, mute);
         checkResult(&result);
+    } else {
+        engineSetMute(engine, mute);
     }
 }
 
+
 JNIEXPORT void JNICALL
 Java_com_hzw_nativeaudio_MainActivity_enableStereoPositionUriAudioPlayer(JNIEnv *env, jobject thiz,
+                                                                         jlong handle,
                                                                          jboolean enable) {
+    NativeEngine *engine = fromHandle(handle);
     SLresult result;
-    SLVolumeItf volume = getVolume();
+    SLVolumeItf volume = getVolume(engine);
     if (volume != NULL) {
         result = (*volume)->EnableStereoPosition(volume, enable);
         checkResult(&result);
+    } else {
+        engine->stereoEnabled = enable;
+        engineApplyStereoPosition(engine);
     }
 }
 
 JNIEXPORT void JNICALL
 Java_com_hzw_nativeaudio_MainActivity_setStereoPositionUriAudioPlayer(JNIEnv *env, jobject thiz,
-                                                                      jint permille) {
+                                                                      jlong handle, jint permille) {
+    NativeEngine *engine = fromHandle(handle);
     SLresult result;
-    SLVolumeItf volume = getVolume();
+    SLVolumeItf volume = getVolume(engine);
     if (volume != NULL) {
         result = (*volume)->SetStereoPosition(volume, permille);
         checkResult(&result);
+    } else {
+        engine->stereoPermille = permille;
+        engineApplyStereoPosition(engine);
     }
 }
 
-JNIEXPORT short *createResampleBuf(uint32_t idx, uint32_t srcRate, unsigned *size) {
-    short *src = NULL;
-    short *workBuf;
-    int upSampleRate;
-    int32_t srcSampleCount = 0;
-
-    if (bqPlayerSampleRate == 0) {
-        return NULL;
-    }
-
-    if (bqPlayerSampleRate % srcRate) {
-        return NULL;
+JNIEXPORT void JNICALL
+Java_com_hzw_nativeaudio_MainActivity_setRampTime(JNIEnv *env, jobject thiz, jlong handle,
+                                                  jint millis) {
+    if (millis >= 0) {
+        audioEngineSetRampTime(fromHandle(handle)->core, (unsigned) millis);
     }
+}
 
-    upSampleRate = bqPlayerSampleRate / srcRate;
-
-    switch (idx) {
-        case 0:
-            return NULL;
-
-        case 1:
-            srcSampleCount = sizeof(hello) >> 1;
-            src = (short *) hello;
-            break;
-
-        case 2:
-            srcSampleCount = sizeof(android) >> 1;
-            src = (short *) android;
-            break;
+JNIEXPORT void JNICALL
+Java_com_hzw_nativeaudio_MainActivity_setResamplerQuality(JNIEnv *env, jobject thiz,
+                                                          jlong handle, jint quality) {
+    audioEngineSetResamplerQuality(fromHandle(handle)->core, quality);
+}
 
-        case 3:
-            srcSampleCount = SAWTOOTH_FRAMES;
-            src = sawtoothBuffer;
-            break;
+JNIEXPORT void JNICALL
+Java_com_hzw_nativeaudio_MainActivity_setDither(JNIEnv *env, jobject thiz, jlong handle,
+                                                jboolean enabled) {
+    audioEngineSetDither(fromHandle(handle)->core, enabled);
+}
 
-        case 4:
-            srcSampleCount = recorderSize / sizeof(short);
-            src = recorderBuffer;
-            break;
-        default:
-            assert(0);
-    }
+JNIEXPORT jboolean JNICALL
+Java_com_hzw_nativeaudio_MainActivity_isFloatOutput(JNIEnv *env, jobject thiz, jlong handle) {
+    AudioBackend *backend = fromHandle(handle)->bqPlayerBackend;
+    return backend != NULL && backend->format == AUDIO_FORMAT_FLOAT ? JNI_TRUE : JNI_FALSE;
+}
 
-    resampleBuf = (short *) malloc((srcSampleCount * upSampleRate) << 1);
-    if (!resampleBuf) {
-        return resampleBuf;
-    }
-    workBuf = resampleBuf;
-    for (int sample = 0; sample < srcSampleCount; ++sample) {
-        for (int dup = 0; dup < upSampleRate; ++dup) {
-            *workBuf++ = src[sample];
-        }
+JNIEXPORT void JNICALL
+Java_com_hzw_nativeaudio_MainActivity_setClipCacheBudget(JNIEnv *env, jobject thiz,
+                                                         jlong handle, jint budgetBytes) {
+    if (budgetBytes >= 0) {
+        audioEngineSetClipCacheBudget(fromHandle(handle)->core, (size_t) budgetBytes);
     }
-    *size = (srcSampleCount * upSampleRate) << 1;
-    return resampleBuf;
 }
 
 jboolean JNICALL
-Java_com_hzw_nativeaudio_MainActivity_selectClip(JNIEnv *env, jobject thiz, jint which,
-                                                 jint count) {
-    if (pthread_mutex_trylock(&audioEngineLock)) {
-        //如果我们无法获取音频引擎锁，请拒绝此请求，客户端应重试
+Java_com_hzw_nativeaudio_MainActivity_selectClip(JNIEnv *env, jobject thiz, jlong handle,
+                                                 jint which, jint count) {
+    return audioEngineSelectClip(fromHandle(handle)->core, which, count) ? JNI_TRUE : JNI_FALSE;
+}
+
+//在剪辑里循环 [start, end)（剪辑自己采样率下的帧），count 为负时一直循环到 selectClip(CLIP_NONE)
+JNIEXPORT jboolean JNICALL
+Java_com_hzw_nativeaudio_MainActivity_selectClipLoop(JNIEnv *env, jobject thiz, jlong handle,
+                                                     jint which, jint count, jint start,
+                                                     jint end, jint crossfade) {
+    if (start < 0 || end < 0 || crossfade < 0) {
         return JNI_FALSE;
     }
+    ClipLoop loop = {(unsigned) start, (unsigned) end, (unsigned) crossfade};
+    return audioEngineSelectClipLoop(fromHandle(handle)->core, which, count, &loop) ? JNI_TRUE
+                                                                                    : JNI_FALSE;
+}
 
-    switch (which) {
-        case 0:
-            nextBuffer = (short *) NULL;
-            nextSize = 0;
-            break;
+//输出时钟，单位是输出采样率下的帧；定时函数的 frame 按它计算，可以在任意线程调用
+JNIEXPORT jlong JNICALL
+Java_com_hzw_nativeaudio_MainActivity_getFrameTime(JNIEnv *env, jobject thiz, jlong handle) {
+    return (jlong) audioEngineFrameTime(fromHandle(handle)->core);
+}
 
-        case 1: //CLIP_HELLO
-            nextBuffer = createResampleBuf(1, SL_SAMPLINGRATE_8, &nextSize);
-            if (!nextBuffer) {
-                nextBuffer = (short *) hello;
-                nextSize = sizeof(hello);
-            }
-            break;
+JNIEXPORT jboolean JNICALL
+Java_com_hzw_nativeaudio_MainActivity_scheduleClip(JNIEnv *env, jobject thiz, jlong handle,
+                                                   jlong frame, jint which, jint count) {
+    return audioEngineScheduleClip(fromHandle(handle)->core, (uint64_t) frame, which, count,
+                                   NULL) ? JNI_TRUE : JNI_FALSE;
+}
 
-        case 2: //CLIP_ANDROID
-            nextBuffer = createResampleBuf(2, SL_SAMPLINGRATE_8, &nextSize);
-            if (!nextBuffer) {
-                nextBuffer = (short *) android;
-                nextSize = sizeof(android);
-            }
-            break;
+JNIEXPORT jboolean JNICALL
+Java_com_hzw_nativeaudio_MainActivity_scheduleStop(JNIEnv *env, jobject thiz, jlong handle,
+                                                   jlong frame) {
+    return audioEngineScheduleStop(fromHandle(handle)->core, (uint64_t) frame) ? JNI_TRUE
+                                                                               : JNI_FALSE;
+}
 
-        case 3: //CLIP_SAWTOOTH
-            nextBuffer = createResampleBuf(3, SL_SAMPLINGRATE_8, &nextSize);
-            if (!nextBuffer) {
-                nextBuffer = (short *) sawtoothBuffer;
-                nextSize = sizeof(sawtoothBuffer);
-            }
-            break;
-
-        case 4: //CLIP_PLAYBACK
-            nextBuffer = createResampleBuf(4, SL_SAMPLINGRATE_16, &nextSize);
-            if (!nextBuffer) {
-                unsigned i;
-                for (i = 0; i < recorderSize; i += sizeof(short)) {
-                    recorderBuffer[i >> 2] = recorderBuffer[i >> 1];
-                }
-                recorderSize = recorderSize >> 1;
-                nextBuffer = recorderBuffer;
-                nextSize = recorderSize;
-            }
-            break;
-
-        default:
-            nextBuffer = NULL;
-            nextSize = 0;
-            break;
-    }
-    nextCount = count;
-    if (nextSize > 0) {
-        //在这里，我们只对一个缓冲区进行排队，因为它是一个长剪辑，但对于流式播放，我们通常会将至少 2 个缓冲区排队以启动
-        SLresult result;
-        result = (*bqPlayerBufferQueue)->Enqueue(bqPlayerBufferQueue, nextBuffer, nextSize);
-        if (result != SL_RESULT_SUCCESS) {
-            pthread_mutex_unlock(&audioEngineLock);
-            return JNI_FALSE;
-        }
-    } else {
-        pthread_mutex_unlock(&audioEngineLock);
-    }
-    return JNI_TRUE;
+JNIEXPORT jboolean JNICALL
+Java_com_hzw_nativeaudio_MainActivity_scheduleGroupVolume(JNIEnv *env, jobject thiz,
+                                                          jlong handle, jlong frame, jint group,
+                                                          jint millibel) {
+    return audioEngineScheduleGroupVolume(fromHandle(handle)->core, (uint64_t) frame, group,
+                                          millibel) ? JNI_TRUE : JNI_FALSE;
 }
 
+//混响作用在引擎的混音总线上，快速音频路径上也可以用；只有缓冲区队列播放器创建之后才有混音总线
 JNIEXPORT jboolean JNICALL
-Java_com_hzw_nativeaudio_MainActivity_enableReverb(JNIEnv *env, jobject thiz, jboolean enable) {
-    SLresult result;
-    if (outputMixEnvironmentalReverb == NULL) {
-        return JNI_FALSE;
-    }
-    if (bqPlayerSampleRate) {
-        return JNI_FALSE;
-    }
-    result = (*bqPlayerEffectSend)->EnableEffectSend(bqPlayerEffectSend,
-                                                     outputMixEnvironmentalReverb,
-                                                     (SLboolean) enable, (SLmillibel) 0);
-    if (result != SL_RESULT_SUCCESS) {
+Java_com_hzw_nativeaudio_MainActivity_enableReverb(JNIEnv *env, jobject thiz, jlong handle,
+                                                   jboolean enable) {
+    NativeEngine *engine = fromHandle(handle);
+    if (engine->bqPlayerBackend == NULL) {
         return JNI_FALSE;
     }
+    audioEngineEnableReverb(engine->core, enable);
     return JNI_TRUE;
 }
 
+//preset 是 reverb.h 中 REVERB_PRESETS 的序号，与 SL_I3DL2_ENVIRONMENT_PRESET_* 一一对应
 JNIEXPORT jboolean JNICALL
-Java_com_hzw_nativeaudio_MainActivity_createAudioRecorder(JNIEnv *env, jobject thiz) {
-    SLresult result;
+Java_com_hzw_nativeaudio_MainActivity_setReverbPreset(JNIEnv *env, jobject thiz, jlong handle,
+                                                      jint preset) {
+    return audioEngineSetReverbPreset(fromHandle(handle)->core, preset) ? JNI_TRUE : JNI_FALSE;
+}
+
 
+//按 format 创建采集 rate 采样率单声道的录音器对象，16 位以外的格式需要 PCM_EX（API 21 起）
+static SLresult createRecorderObject(NativeEngine *engine, unsigned rate, CaptureFormat format) {
+    Recorder *recorder = &engine->recorder;
     // configure audio source
     SLDataLocator_IODevice loc_dev = {
             SL_DATALOCATOR_IODEVICE,
@@ -707,146 +981,352 @@ Java_com_hzw_nativeaudio_MainActivity_createAudioRecorder(JNIEnv *env, jobject t
 
     // configure audio sink
     SLDataLocator_AndroidSimpleBufferQueue loc_bq = {
-            SL_DATALOCATOR_ANDROIDSIMPLEBUFFERQUEUE, 2};
+            SL_DATALOCATOR_ANDROIDSIMPLEBUFFERQUEUE, RECORDER_CAPTURE_BUFFERS};
     SLDataFormat_PCM format_pcm = {
             SL_DATAFORMAT_PCM, 1,
-            SL_SAMPLINGRATE_16, SL_PCMSAMPLEFORMAT_FIXED_16,
+            rate * 1000, SL_PCMSAMPLEFORMAT_FIXED_16,
             SL_PCMSAMPLEFORMAT_FIXED_16, SL_SPEAKER_FRONT_CENTER,
             SL_BYTEORDER_LITTLEENDIAN};
-    SLDataSink audioSnk = {&loc_bq, &format_pcm};
+    SLAndroidDataFormat_PCM_EX format_pcm_ex = {
+            SL_ANDROID_DATAFORMAT_PCM_EX, 1,
+            rate * 1000, SL_PCMSAMPLEFORMAT_FIXED_32,
+            SL_PCMSAMPLEFORMAT_FIXED_32, SL_SPEAKER_FRONT_CENTER,
+            SL_BYTEORDER_LITTLEENDIAN, SL_ANDROID_PCM_REPRESENTATION_FLOAT};
+    if (format == CAPTURE_FORMAT_S24) {
+        format_pcm_ex.bitsPerSample = SL_PCMSAMPLEFORMAT_FIXED_24;
+        format_pcm_ex.containerSize = SL_PCMSAMPLEFORMAT_FIXED_24;
+        format_pcm_ex.representation = SL_ANDROID_PCM_REPRESENTATION_SIGNED_INT;
+    }
+    SLDataSink audioSnk = {&loc_bq, format == CAPTURE_FORMAT_S16 ? (void *) &format_pcm
+                                                                 : (void *) &format_pcm_ex};
 
     // create audio recorder
     // (requires the RECORD_AUDIO permission)
     const SLInterfaceID id[1] = {SL_IID_ANDROIDSIMPLEBUFFERQUEUE};
     const SLboolean req[1] = {SL_BOOLEAN_TRUE};
-    result = (*enginEngine)->CreateAudioRecorder(enginEngine, &recorderObject, &audioSrc, &audioSnk,
-                                                 1, id, req);
+    SLresult result = (*engine->enginEngine)->CreateAudioRecorder(engine->enginEngine,
+                                                                  &recorder->object, &audioSrc,
+                                                                  &audioSnk, 1, id, req);
+    if (SL_RESULT_SUCCESS != result) {
+        recorder->object = NULL;
+        return result;
+    }
+    result = (*recorder->object)->Realize(recorder->object, SL_BOOLEAN_FALSE);
     if (SL_RESULT_SUCCESS != result) {
+        (*recorder->object)->Destroy(recorder->object);
+        recorder->object = NULL;
+    }
+    return result;
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_hzw_nativeaudio_MainActivity_createAudioRecorder(JNIEnv *env, jobject thiz,
+                                                          jlong handle, jint storageRate,
+                                                          jint format) {
+    NativeEngine *engine = fromHandle(handle);
+    Recorder *recorder = &engine->recorder;
+    SLresult result;
+    if (recorder->object != NULL || format < CAPTURE_FORMAT_S16 || format > CAPTURE_FORMAT_FLOAT ||
+        storageRate <= 0 || !audioEngineSetRecorderRate(engine->core, (unsigned) storageRate)) {
         return JNI_FALSE;
     }
 
-    result = (*recorderObject)->Realize(recorderObject, SL_BOOLEAN_FALSE);
+    //拿到设备本机采样率时按它采集；设备不支持所要的格式时退回 16 位，仍然不行就让平台重采样到存储采样率
+    unsigned deviceRate = engine->bqPlayerSampleRate ? engine->bqPlayerSampleRate / 1000
+                                                     : (unsigned) storageRate;
+    if (deviceRate > RECORDER_MAX_DEVICE_RATE) {
+        deviceRate = (unsigned) storageRate;
+    }
+    CaptureFormat captureFormat = (CaptureFormat) format;
+    result = createRecorderObject(engine, deviceRate, captureFormat);
+    if (SL_RESULT_SUCCESS != result && captureFormat != CAPTURE_FORMAT_S16) {
+        captureFormat = CAPTURE_FORMAT_S16;
+        result = createRecorderObject(engine, deviceRate, captureFormat);
+    }
+    if (SL_RESULT_SUCCESS != result && deviceRate != (unsigned) storageRate) {
+        deviceRate = (unsigned) storageRate;
+        result = createRecorderObject(engine, deviceRate, captureFormat);
+    }
     if (SL_RESULT_SUCCESS != result) {
         return JNI_FALSE;
     }
 
-    result = (*recorderObject)->GetInterface(recorderObject, SL_IID_RECORD, &recorderRecord);
+    recorder->chunkFrames = deviceRate / RECORDER_CHUNKS_PER_SECOND;
+    recorder->chunkBytes = recorder->chunkFrames * (captureFormat == CAPTURE_FORMAT_S16 ? 2 :
+                                                    captureFormat == CAPTURE_FORMAT_S24 ? 3 : 4);
+    if (!captureDecimatorInit(&recorder->decimator, deviceRate, (unsigned) storageRate,
+                              captureFormat, RESAMPLER_QUALITY_MEDIUM, recorder->chunkFrames)) {
+        goto fail;
+    }
+    recorder->storage = (short *) malloc(captureDecimatorMaxOutput(&recorder->decimator) *
+                                         sizeof(short));
+    if (recorder->storage == NULL) {
+        goto fail;
+    }
+
+    result = (*recorder->object)->GetInterface(recorder->object, SL_IID_RECORD, &recorder->record);
     if (SL_RESULT_SUCCESS != result) {
-        return JNI_FALSE;
+        goto fail;
     }
-    UNUSED(result);
 
-    result = (*recorderObject)->GetInterface(recorderObject, SL_IID_ANDROIDSIMPLEBUFFERQUEUE,
-                                             &recorderBufferQueue);
+    result = (*recorder->object)->GetInterface(recorder->object, SL_IID_ANDROIDSIMPLEBUFFERQUEUE,
+                                               &recorder->bufferQueue);
     if (SL_RESULT_SUCCESS != result) {
-        return JNI_FALSE;
+        goto fail;
     }
-    UNUSED(result);
 
-    result = (*recorderBufferQueue)->RegisterCallback(recorderBufferQueue, bqRecorderCallback,
-                                                      NULL);
+    result = (*recorder->bufferQueue)->RegisterCallback(recorder->bufferQueue, bqRecorderCallback,
+                                                        engine);
     if (SL_RESULT_SUCCESS != result) {
-        return JNI_FALSE;
+        goto fail;
     }
-    UNUSED(result);
+    callbackStatsInit(&engine->recorderStats,
+                      (uint64_t) recorder->chunkFrames * 1000000000u / deviceRate);
 
     return JNI_TRUE;
+
+    fail:
+    //回到没有录音器的状态，之后还可以重试
+    (*recorder->object)->Destroy(recorder->object);
+    recorder->object = NULL;
+    recorder->record = NULL;
+    recorder->bufferQueue = NULL;
+    captureDecimatorRelease(&recorder->decimator);
+    free(recorder->storage);
+    recorder->storage = NULL;
+    return JNI_FALSE;
+}
+
+//录音回调已经不再运行时调用：摘下消费者，写完剩余数据并补全文件头
+static void closeRecordWriter(NativeEngine *engine) {
+    Recorder *recorder = &engine->recorder;
+    if (recorder->writer != NULL) {
+        audioEngineRemoveCaptureConsumer(engine->core, recordWriterPush, recorder->writer);
+        recordWriterClose(recorder->writer, NULL);
+        recorder->writer = NULL;
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_com_hzw_nativeaudio_MainActivity_setRecordingFile(JNIEnv *env, jobject thiz, jlong handle,
+                                                       jstring path, jboolean raw) {
+    Recorder *recorder = &fromHandle(handle)->recorder;
+    free(recorder->path);
+    recorder->path = NULL;
+    if (path != NULL) {
+        const char *utf8 = (*env)->GetStringUTFChars(env, path, NULL);
+        if (utf8 != NULL) {
+            size_t length = strlen(utf8) + 1;
+            recorder->path = (char *) malloc(length);
+            if (recorder->path != NULL) {
+                memcpy(recorder->path, utf8, length);
+            }
+            (*env)->ReleaseStringUTFChars(env, path, utf8);
+        }
+    }
+    recorder->format = raw ? RECORD_FORMAT_RAW : RECORD_FORMAT_WAV;
 }
 
 JNIEXPORT jboolean JNICALL
-Java_com_hzw_nativeaudio_MainActivity_startRecording(JNIEnv *env, jobject thiz) {
+Java_com_hzw_nativeaudio_MainActivity_startRecording(JNIEnv *env, jobject thiz, jlong handle) {
+    NativeEngine *engine = fromHandle(handle);
+    Recorder *recorder = &engine->recorder;
     SLresult result;
-    if (pthread_mutex_trylock(&audioEngineLock)) {
-        return JNI_FALSE;
-    }
 
     //如果已经录制，请停止录制并清除缓冲区队列
-    result = (*recorderRecord)->SetRecordState(recorderRecord, SL_RECORDSTATE_STOPPED);
+    result = (*recorder->record)->SetRecordState(recorder->record, SL_RECORDSTATE_STOPPED);
     if (SL_RESULT_SUCCESS != result) {
         return JNI_FALSE;
     }
     UNUSED(result);
-    result = (*recorderBufferQueue)->Clear(recorderBufferQueue);
+    result = (*recorder->bufferQueue)->Clear(recorder->bufferQueue);
     if (SL_RESULT_SUCCESS != result) {
         return JNI_FALSE;
     }
     UNUSED(result);
+    audioEngineRecordingStopped(engine->core);
+    closeRecordWriter(engine);
+
+    //文件打不开时照常录音，只是不保存
+    if (recorder->path != NULL) {
+        recorder->writer = recordWriterOpen(recorder->path, recorder->format,
+                                            audioEngineRecorderRate(engine->core));
+        if (recorder->writer != NULL &&
+            !audioEngineAddCaptureConsumer(engine->core, recordWriterPush, recorder->writer)) {
+            recordWriterClose(recorder->writer, NULL);
+            recorder->writer = NULL;
+        }
+    }
 
     //缓冲区尚不能播放
-    recorderSize = 0;
+    audioEngineRecordingStarted(engine->core);
+    captureDecimatorReset(&recorder->decimator);
 
-    //将一个空缓冲区排队由记录器填充（对于流式录制，我们将至少排队 2 个空缓冲区以开始工作）
-    result = (*recorderBufferQueue)->Enqueue(recorderBufferQueue, recorderBuffer,RECORDER_FRAMES * sizeof(short));
+    //把所有小缓冲区都排队由记录器填充，之后 bqRecorderCallback 每取走一个就放回一个
+    unsigned i;
+    recorder->chunkIndex = 0;
+    for (i = 0; i < RECORDER_CAPTURE_BUFFERS; ++i) {
+        result = (*recorder->bufferQueue)->Enqueue(recorder->bufferQueue, recorder->chunks[i],
+                                                   recorder->chunkBytes);
+        if (SL_RESULT_SUCCESS != result) {
+            audioEngineRecordingStopped(engine->core);
+            closeRecordWriter(engine);
+            return JNI_FALSE;
+        }
+    }
+
+    result = (*recorder->record)->SetRecordState(recorder->record, SL_RECORDSTATE_RECORDING);
     if (SL_RESULT_SUCCESS != result) {
+        audioEngineRecordingStopped(engine->core);
+        closeRecordWriter(engine);
         return JNI_FALSE;
     }
     UNUSED(result);
 
-    result = (*recorderRecord)->SetRecordState(recorderRecord, SL_RECORDSTATE_RECORDING);
+    return JNI_TRUE;
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_hzw_nativeaudio_MainActivity_stopRecording(JNIEnv *env, jobject thiz, jlong handle) {
+    NativeEngine *engine = fromHandle(handle);
+    Recorder *recorder = &engine->recorder;
+    SLresult result;
+    if (recorder->record == NULL) {
+        return JNI_FALSE;
+    }
+    result = (*recorder->record)->SetRecordState(recorder->record, SL_RECORDSTATE_STOPPED);
     if (SL_RESULT_SUCCESS != result) {
         return JNI_FALSE;
     }
-    UNUSED(result);
+    (*recorder->bufferQueue)->Clear(recorder->bufferQueue);
+    //最近 5 秒从这里开始可以作为 CLIP_PLAYBACK 播放
+    audioEngineRecordingStopped(engine->core);
+    closeRecordWriter(engine);
+    return JNI_TRUE;
+}
+
+JNIEXPORT jlongArray JNICALL
+Java_com_hzw_nativeaudio_MainActivity_getCallbackStats(JNIEnv *env, jobject thiz,
+                                                       jlong handle, jboolean recorder) {
+    NativeEngine *engine = fromHandle(handle);
+    //只读取原子计数，不会让音频回调等待；回调一直在改写导致取不到一致的快照时返回 null
+    jlong values[CALLBACK_STATS_FIELDS];
+    if (!callbackStatsSnapshot(recorder ? &engine->recorderStats : &engine->playerStats,
+                               (int64_t *) values)) {
+        return NULL;
+    }
+    jlongArray array = (*env)->NewLongArray(env, CALLBACK_STATS_FIELDS);
+    if (array != NULL) {
+        (*env)->SetLongArrayRegion(env, array, 0, CALLBACK_STATS_FIELDS, values);
+    }
+    return array;
+}
 
+JNIEXPORT jboolean JNICALL
+Java_com_hzw_nativeaudio_MainActivity_startMonitor(JNIEnv *env, jobject thiz, jlong handle,
+                                                   jfloat gain) {
+    NativeEngine *engine = fromHandle(handle);
+    Recorder *recorder = &engine->recorder;
+    //监听需要播放器和录音器都已创建；录音还没开始时顺便开始
+    if (engine->bqPlayerBackend == NULL || recorder->record == NULL) {
+        return JNI_FALSE;
+    }
+    //当前突发渲染完后，设备队列里还排着其它缓冲区；只有一个缓冲区的后端没有排队
+    unsigned buffered = engine->bqPlayerBackend->bufferedBursts;
+    unsigned delay = buffered > 1 ? (buffered - 1) * engine->bqPlayerBackend->burstFrames : 0;
+    if (!audioEngineStartMonitor(engine->core, gain, recorder->decimator.inRate, delay)) {
+        return JNI_FALSE;
+    }
+    SLuint32 state;
+    SLresult result = (*recorder->record)->GetRecordState(recorder->record, &state);
+    if (SL_RESULT_SUCCESS != result || state != SL_RECORDSTATE_RECORDING) {
+        if (!Java_com_hzw_nativeaudio_MainActivity_startRecording(env, thiz, handle)) {
+            audioEngineStopMonitor(engine->core);
+            return JNI_FALSE;
+        }
+    }
     return JNI_TRUE;
 }
 
 JNIEXPORT void JNICALL
-Java_com_hzw_nativeaudio_MainActivity_shutdown(JNIEnv *env, jobject thiz) {
-// destroy buffer queue audio player object, and invalidate all associated
-    // interfaces
-    if (bqPlayerObject != NULL) {
-        (*bqPlayerObject)->Destroy(bqPlayerObject);
-        bqPlayerObject = NULL;
-        bqPlayerPlay = NULL;
-        bqPlayerBufferQueue = NULL;
-        bqPlayerEffectSend = NULL;
-        bqPlayerMuteSolo = NULL;
-        bqPlayerVolume = NULL;
+Java_com_hzw_nativeaudio_MainActivity_stopMonitor(JNIEnv *env, jobject thiz, jlong handle) {
+    audioEngineStopMonitor(fromHandle(handle)->core);
+}
+
+JNIEXPORT jlongArray JNICALL
+Java_com_hzw_nativeaudio_MainActivity_getMonitorStats(JNIEnv *env, jobject thiz, jlong handle) {
+    jlong values[MONITOR_STATS_FIELDS];
+    audioEngineMonitorStats(fromHandle(handle)->core, (int64_t *) values);
+    jlongArray array = (*env)->NewLongArray(env, MONITOR_STATS_FIELDS);
+    if (array != NULL) {
+        (*env)->SetLongArrayRegion(env, array, 0, MONITOR_STATS_FIELDS, values);
     }
+    return array;
+}
 
-    // destroy file descriptor audio player object, and invalidate all associated
-    // interfaces
-    if (fdPlayerObject != NULL) {
-        (*fdPlayerObject)->Destroy(fdPlayerObject);
-        fdPlayerObject = NULL;
-        fdPlayerPlay = NULL;
-        fdPlayerSeek = NULL;
-        fdPlayerMuteSolo = NULL;
-        fdPlayerVolume = NULL;
+JNIEXPORT void JNICALL
+Java_com_hzw_nativeaudio_MainActivity_shutdown(JNIEnv *env, jobject thiz, jlong handle) {
+    NativeEngine *engine = fromHandle(handle);
+    if (engine == NULL) {
+        return;
     }
+    AssetPlayer *asset = &engine->asset;
+    Recorder *recorder = &engine->recorder;
+    //后台启动还没结束时先等它，之后才能销毁它正在创建的对象
+    Java_com_hzw_nativeaudio_MainActivity_awaitEngine(env, thiz, handle);
+// destroy buffer queue audio player object, and invalidate all associated
+    // interfaces
+    destroyPlayer(engine);
 
-    // destroy URI audio player object, and invalidate all associated interfaces
-    if (uriPlayerObject != NULL) {
-        (*uriPlayerObject)->Destroy(uriPlayerObject);
-        uriPlayerObject = NULL;
-        uriPlayerPlay = NULL;
-        uriPlayerSeek = NULL;
-        uriPlayerMuteSolo = NULL;
-        uriPlayerVolume = NULL;
+    //播放器已经销毁，回调线程不会再运行，可以释放引擎的资源
+    audioEngineShutdown(engine->core);
+    if (asset->wavMapped) {
+        mappedWavUnmap(&asset->wav);
+        asset->wavMapped = false;
     }
+    free(asset->decoded);
+    asset->decoded = NULL;
+
+    // destroy file descriptor and URI audio player objects, and invalidate all associated
+    // interfaces
+    //池里的播放器（包括签出的）全部销毁，之后才关闭 fd 播放器的文件描述符
+    asset->fd = NULL;
+    engine->uri = NULL;
+    playerPoolRelease(&engine->players);
 
     // destroy audio recorder object, and invalidate all associated interfaces
-    if (recorderObject != NULL) {
-        (*recorderObject)->Destroy(recorderObject);
-        recorderObject = NULL;
-        recorderRecord = NULL;
-        recorderBufferQueue = NULL;
+    if (recorder->object != NULL) {
+        (*recorder->object)->Destroy(recorder->object);
+        audioEngineRecordingStopped(engine->core);
+        closeRecordWriter(engine);
+        recorder->object = NULL;
+        recorder->record = NULL;
+        recorder->bufferQueue = NULL;
     }
+    captureDecimatorRelease(&recorder->decimator);
+    free(recorder->storage);
+    recorder->storage = NULL;
+    free(recorder->path);
+    recorder->path = NULL;
 
     // destroy output mix object, and invalidate all associated interfaces
-    if (outputMixObject != NULL) {
-        (*outputMixObject)->Destroy(outputMixObject);
-        outputMixObject = NULL;
-        outputMixEnvironmentalReverb = NULL;
+    if (engine->outputMixObject != NULL) {
+        (*engine->outputMixObject)->Destroy(engine->outputMixObject);
+        engine->outputMixObject = NULL;
     }
 
     // destroy engine object, and invalidate all associated interfaces
-    if (engineObject != NULL) {
-        (*engineObject)->Destroy(engineObject);
-        engineObject = NULL;
-        enginEngine = NULL;
+    if (engine->engineObject != NULL) {
+        (*engine->engineObject)->Destroy(engine->engineObject);
+        engine->engineObject = NULL;
+        engine->enginEngine = NULL;
     }
 
-    pthread_mutex_destroy(&audioEngineLock);
-}
\ No newline at end of file
+    //录音器也已经销毁，最后释放引擎核心和上下文本身，句柄从此失效
+    audioEngineDestroy(engine->core);
+    pthread_cond_destroy(&engine->startup.realized);
+    pthread_mutex_destroy(&engine->startup.lock);
+    pthread_mutex_destroy(&engine->startup.joinLock);
+    pthread_mutex_destroy(&engine->playersLock);
+    free(engine);
+}
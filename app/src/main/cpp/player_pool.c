@@ -0,0 +1,188 @@
+#include "player_pool.h"
+
+#include <string.h>
+#include <unistd.h>
+
+#define UNUSED(x) (void)(x);
+
+void playerPoolInit(PlayerPool *pool, SLEngineItf engine, SLObjectItf outputMix) {
+    memset(pool, 0, sizeof(PlayerPool));
+    pool->engine = engine;
+    pool->outputMix = outputMix;
+}
+
+static void destroySlot(PlayerPoolSlot *slot) {
+    if (slot->player.object != NULL) {
+        (*slot->player.object)->Destroy(slot->player.object);
+    }
+    //播放器销毁之后它才不再读取文件描述符
+    if (slot->fd >= 0) {
+        close(slot->fd);
+    }
+    memset(slot, 0, sizeof(PlayerPoolSlot));
+    slot->fd = -1;
+}
+
+void playerPoolRelease(PlayerPool *pool) {
+    unsigned i;
+    for (i = 0; i < PLAYER_POOL_SIZE; ++i) {
+        if (pool->slots[i].used) {
+            destroySlot(&pool->slots[i]);
+        }
+    }
+}
+
+static PlayerPoolSlot *slotOf(PlayerPool *pool, SlPlayer *player) {
+    unsigned i;
+    for (i = 0; i < PLAYER_POOL_SIZE; ++i) {
+        if (pool->slots[i].used && &pool->slots[i].player == player) {
+            return &pool->slots[i];
+        }
+    }
+    return NULL;
+}
+
+static SlPlayer *checkOut(PlayerPool *pool, PlayerPoolSlot *slot) {
+    slot->checkedOut = true;
+    slot->lastUse = ++pool->clock;
+    return &slot->player;
+}
+
+SlPlayer *playerPoolAcquire(PlayerPool *pool, PlayerSourceType type, const char *key) {
+    unsigned i;
+    for (i = 0; i < PLAYER_POOL_SIZE; ++i) {
+        PlayerPoolSlot *slot = &pool->slots[i];
+        if (slot->used && !slot->checkedOut && slot->cacheable && slot->type == type &&
+            strcmp(slot->key, key) == 0) {
+            return checkOut(pool, slot);
+        }
+    }
+    return NULL;
+}
+
+//找一个空位，没有时淘汰最久没用的空闲播放器；全部签出时返回 NULL
+static PlayerPoolSlot *claimSlot(PlayerPool *pool) {
+    PlayerPoolSlot *victim = NULL;
+    unsigned i;
+    for (i = 0; i < PLAYER_POOL_SIZE; ++i) {
+        PlayerPoolSlot *slot = &pool->slots[i];
+        if (!slot->used) {
+            return slot;
+        }
+        if (!slot->checkedOut && (victim == NULL || slot->lastUse < victim->lastUse)) {
+            victim = slot;
+        }
+    }
+    if (victim != NULL) {
+        destroySlot(victim);
+    }
+    return victim;
+}
+
+//创建、实例化并取出所有接口；失败时 slot 保持空闲
+static SlPlayer *createPlayer(PlayerPool *pool, PlayerPoolSlot *slot, PlayerSourceType type,
+                              const char *key, int fd, SLDataSource *audioSrc) {
+    SLresult result;
+    // 配置音频接收器
+    SLDataLocator_OutputMix loc_outmix = {SL_DATALOCATOR_OUTPUTMIX, pool->outputMix};
+    SLDataSink audioSnk = {&loc_outmix, NULL};
+
+    slot->used = true;
+    slot->fd = fd;
+    // 创建音频播放器
+    const SLInterfaceID ids[3] = {SL_IID_SEEK, SL_IID_MUTESOLO, SL_IID_VOLUME};
+    const SLboolean req[3] = {SL_BOOLEAN_TRUE, SL_BOOLEAN_TRUE, SL_BOOLEAN_TRUE};
+    result = (*pool->engine)->CreateAudioPlayer(pool->engine, &slot->player.object, audioSrc,
+                                                &audioSnk, 3, ids, req);
+    if (SL_RESULT_SUCCESS != result) {
+        slot->player.object = NULL;
+        destroySlot(slot);
+        return NULL;
+    }
+    // 实例化播放器。无效的 URI 在这里或者之后的预取中才会发现
+    result = (*slot->player.object)->Realize(slot->player.object, SL_BOOLEAN_FALSE);
+    if (SL_RESULT_SUCCESS == result) {
+        result = (*slot->player.object)->GetInterface(slot->player.object, SL_IID_PLAY,
+                                                      &slot->player.play);
+    }
+    if (SL_RESULT_SUCCESS == result) {
+        result = (*slot->player.object)->GetInterface(slot->player.object, SL_IID_SEEK,
+                                                      &slot->player.seek);
+    }
+    if (SL_RESULT_SUCCESS == result) {
+        result = (*slot->player.object)->GetInterface(slot->player.object, SL_IID_MUTESOLO,
+                                                      &slot->player.muteSolo);
+    }
+    if (SL_RESULT_SUCCESS == result) {
+        result = (*slot->player.object)->GetInterface(slot->player.object, SL_IID_VOLUME,
+                                                      &slot->player.volume);
+    }
+    if (SL_RESULT_SUCCESS != result) {
+        destroySlot(slot);
+        return NULL;
+    }
+
+    slot->type = type;
+    size_t length = strlen(key);
+    slot->cacheable = length < PLAYER_POOL_KEY_BYTES;
+    if (slot->cacheable) {
+        memcpy(slot->key, key, length + 1);
+    }
+    return checkOut(pool, slot);
+}
+
+SlPlayer *playerPoolCreateFd(PlayerPool *pool, const char *key, int fd, off_t start,
+                             off_t length) {
+    PlayerPoolSlot *slot = claimSlot(pool);
+    if (slot == NULL) {
+        close(fd);
+        return NULL;
+    }
+    // 配置音频源
+    SLDataLocator_AndroidFD loc_fd = {SL_DATALOCATOR_ANDROIDFD, fd, start, length};
+    SLDataFormat_MIME format_mime = {SL_DATAFORMAT_MIME, NULL, SL_CONTAINERTYPE_UNSPECIFIED};
+    SLDataSource audioSrc = {&loc_fd, &format_mime};
+    return createPlayer(pool, slot, PLAYER_SOURCE_FD, key, fd, &audioSrc);
+}
+
+SlPlayer *playerPoolCreateUri(PlayerPool *pool, const char *uri) {
+    PlayerPoolSlot *slot = claimSlot(pool);
+    if (slot == NULL) {
+        return NULL;
+    }
+    // 配置音频源 需要网络访问权限
+    SLDataLocator_URI loc_uri = {SL_DATALOCATOR_URI, (SLchar *) uri};
+    SLDataFormat_MIME format_mime = {SL_DATAFORMAT_MIME, NULL, SL_CONTAINERTYPE_UNSPECIFIED};
+    SLDataSource audioSrc = {&loc_uri, &format_mime};
+    return createPlayer(pool, slot, PLAYER_SOURCE_URI, uri, -1, &audioSrc);
+}
+
+void playerPoolPut(PlayerPool *pool, SlPlayer *player) {
+    PlayerPoolSlot *slot = slotOf(pool, player);
+    if (slot == NULL) {
+        return;
+    }
+    if (!slot->cacheable) {
+        destroySlot(slot);
+        return;
+    }
+    //恢复到刚实例化时的状态，下一个签出者看到的和新建的播放器一样；停止同时回到开头
+    SLresult result;
+    result = (*player->play)->SetPlayState(player->play, SL_PLAYSTATE_STOPPED);
+    result = (*player->seek)->SetLoop(player->seek, SL_BOOLEAN_FALSE, 0, SL_TIME_UNKNOWN);
+    result = (*player->volume)->SetVolumeLevel(player->volume, 0);
+    result = (*player->volume)->SetMute(player->volume, SL_BOOLEAN_FALSE);
+    result = (*player->volume)->EnableStereoPosition(player->volume, SL_BOOLEAN_FALSE);
+    result = (*player->volume)->SetStereoPosition(player->volume, 0);
+    SLuint8 channels = 0;
+    //预取完成之前还不知道声道数，那时也不可能设置过
+    if ((*player->muteSolo)->GetNumChannels(player->muteSolo, &channels) == SL_RESULT_SUCCESS) {
+        SLuint8 i;
+        for (i = 0; i < channels; ++i) {
+            result = (*player->muteSolo)->SetChannelMute(player->muteSolo, i, SL_BOOLEAN_FALSE);
+            result = (*player->muteSolo)->SetChannelSolo(player->muteSolo, i, SL_BOOLEAN_FALSE);
+        }
+    }
+    UNUSED(result)
+    slot->checkedOut = false;
+}
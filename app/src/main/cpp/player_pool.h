@@ -0,0 +1,73 @@
+#ifndef NATIVEAUDIO_PLAYER_POOL_H
+#define NATIVEAUDIO_PLAYER_POOL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#include <SLES/OpenSLES.h>
+#include <SLES/OpenSLES_Android.h>
+
+//OpenSL 直接播放（fd 或 URI 数据源）的音频播放器池。创建一个播放器要 CreateAudioPlayer、同步 Realize
+//和五次 GetInterface，要几十毫秒；OpenSL 的数据源在创建时就固定了，所以归还的播放器保持实例化状态
+//按数据源留在池里，再次签出同一个资源或 URI 只是查一次表。池的大小固定，创建新播放器时池满了就销毁
+//最久没用的空闲播放器，全部签出时创建失败。fd 播放器拥有它的文件描述符，对象销毁后才关闭。
+//只在控制线程中使用
+#define PLAYER_POOL_SIZE 4
+//数据源标识（资源名或 URI）的最大长度，更长的数据源不进池，归还时直接销毁
+#define PLAYER_POOL_KEY_BYTES 256
+
+typedef enum {
+    PLAYER_SOURCE_FD = 0,
+    PLAYER_SOURCE_URI,
+} PlayerSourceType;
+
+//一个实例化好的播放器和它的接口
+typedef struct {
+    SLObjectItf object;
+    SLPlayItf play;
+    SLSeekItf seek;
+    SLMuteSoloItf muteSolo;
+    SLVolumeItf volume;
+} SlPlayer;
+
+typedef struct {
+    SlPlayer player;
+    PlayerSourceType type;
+    char key[PLAYER_POOL_KEY_BYTES];
+    bool cacheable;
+    //fd 数据源的文件描述符，URI 为 -1
+    int fd;
+    bool used;
+    bool checkedOut;
+    //最近一次签出的序号，池满时淘汰最小的空闲播放器
+    uint64_t lastUse;
+} PlayerPoolSlot;
+
+typedef struct {
+    SLEngineItf engine;
+    SLObjectItf outputMix;
+    PlayerPoolSlot slots[PLAYER_POOL_SIZE];
+    uint64_t clock;
+} PlayerPool;
+
+void playerPoolInit(PlayerPool *pool, SLEngineItf engine, SLObjectItf outputMix);
+
+//销毁池里所有播放器（包括还没归还的）并关闭它们的文件描述符
+void playerPoolRelease(PlayerPool *pool);
+
+//签出一个数据源相同的空闲播放器，它处于停止状态、不循环、音量和声道设置都是默认值。没有时返回 NULL
+SlPlayer *playerPoolAcquire(PlayerPool *pool, PlayerSourceType type, const char *key);
+
+//为 fd 中从 start 开始的 length 字节创建并签出一个新播放器，key 是它的数据源标识（例如资源名）。
+//fd 的所有权交给池，失败时也由池关闭
+SlPlayer *playerPoolCreateFd(PlayerPool *pool, const char *key, int fd, off_t start,
+                             off_t length);
+
+//为 URI 创建并签出一个新播放器，URI 同时作为数据源标识
+SlPlayer *playerPoolCreateUri(PlayerPool *pool, const char *uri);
+
+//停止播放、恢复默认设置后放回池里，之后可以再次签出
+void playerPoolPut(PlayerPool *pool, SlPlayer *player);
+
+#endif //NATIVEAUDIO_PLAYER_POOL_H
@@ -0,0 +1,188 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "record_writer.h"
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "spsc_queue.h"
+#include "wav_format.h"
+
+//队列元素：一小段样本按值拷贝，录音回调的块更大时拆成几段
+#define RECORD_SLOT_FRAMES 512
+//约 2 秒的 16 kHz 单声道，写线程偶尔被存储卡卡住也不会丢数据
+#define RECORD_QUEUE_SLOTS 64
+//写线程队列为空时的睡眠间隔，远小于队列能缓冲的时长
+#define RECORD_POLL_NS (10 * 1000 * 1000)
+
+typedef struct {
+    unsigned frames;
+    short pcm[RECORD_SLOT_FRAMES];
+} RecordSlot;
+
+struct RecordWriter {
+    int fd;
+    RecordFormat format;
+    unsigned sampleRate;
+    SpscQueue queue;
+    pthread_t thread;
+    atomic_bool stopping;
+    atomic_uint_fast64_t dropped;
+
+    //以下只由写线程使用，join 之后由 recordWriterClose 读取
+    unsigned char *batch;
+    unsigned batchBytes;
+    uint64_t dataBytes;
+    bool failed;
+};
+
+static bool writeAll(int fd, const unsigned char *data, size_t bytes) {
+    while (bytes > 0) {
+        ssize_t n = write(fd, data, bytes);
+        if (n < 0) {
+            return false;
+        }
+        data += n;
+        bytes -= (size_t) n;
+    }
+    return true;
+}
+
+static void flushBatch(RecordWriter *writer) {
+    if (writer->batchBytes > 0 && !writer->failed &&
+        !writeAll(writer->fd, writer->batch, writer->batchBytes)) {
+        writer->failed = true;
+    }
+    writer->batchBytes = 0;
+}
+
+static void appendSlot(RecordWriter *writer, const RecordSlot *slot) {
+    const unsigned char *src = (const unsigned char *) slot->pcm;
+    unsigned bytes = slot->frames * sizeof(short);
+    //WAV 的 data 块长度是 32 位的，写满后多出来的部分不再写入
+    if (writer->format == RECORD_FORMAT_WAV &&
+        writer->dataBytes + bytes > UINT32_MAX - WAV_HEADER_BYTES) {
+        return;
+    }
+    writer->dataBytes += bytes;
+    while (bytes > 0) {
+        unsigned n = RECORD_WRITER_BATCH_BYTES - writer->batchBytes;
+        if (n > bytes) {
+            n = bytes;
+        }
+        memcpy(writer->batch + writer->batchBytes, src, n);
+        writer->batchBytes += n;
+        src += n;
+        bytes -= n;
+        if (writer->batchBytes == RECORD_WRITER_BATCH_BYTES) {
+            flushBatch(writer);
+        }
+    }
+}
+
+static void *writerThread(void *arg) {
+    RecordWriter *writer = (RecordWriter *) arg;
+    RecordSlot slot;
+    const struct timespec poll = {0, RECORD_POLL_NS};
+    for (;;) {
+        //先读 stopping 再取数据：看到停止标志之后取空队列，就不会漏掉最后几块
+        bool stopping = atomic_load_explicit(&writer->stopping, memory_order_acquire);
+        bool any = false;
+        while (spscQueuePop(&writer->queue, &slot)) {
+            appendSlot(writer, &slot);
+            any = true;
+        }
+        if (stopping) {
+            break;
+        }
+        if (!any) {
+            nanosleep(&poll, NULL);
+        }
+    }
+    flushBatch(writer);
+    return NULL;
+}
+
+RecordWriter *recordWriterOpen(const char *path, RecordFormat format, unsigned sampleRate) {
+    RecordWriter *writer = (RecordWriter *) calloc(1, sizeof(RecordWriter));
+    if (writer == NULL) {
+        return NULL;
+    }
+    writer->format = format;
+    writer->sampleRate = sampleRate;
+    atomic_init(&writer->stopping, false);
+    atomic_init(&writer->dropped, 0);
+    writer->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (writer->fd < 0) {
+        free(writer);
+        return NULL;
+    }
+    if (posix_memalign((void **) &writer->batch, 4096, RECORD_WRITER_BATCH_BYTES) != 0) {
+        writer->batch = NULL;
+    }
+    if (writer->batch == NULL ||
+        !spscQueueInit(&writer->queue, sizeof(RecordSlot), RECORD_QUEUE_SLOTS)) {
+        goto fail;
+    }
+    //文件头占位，长度在关闭时补上；它和第一批数据一起写出，之后每次写入都从整块边界开始
+    if (format == RECORD_FORMAT_WAV) {
+        wavFormatHeader(writer->batch, sampleRate, 1, 16, 0);
+        writer->batchBytes = WAV_HEADER_BYTES;
+    }
+    if (pthread_create(&writer->thread, NULL, writerThread, writer) != 0) {
+        goto fail;
+    }
+    return writer;
+
+    fail:
+    spscQueueRelease(&writer->queue);
+    free(writer->batch);
+    close(writer->fd);
+    free(writer);
+    return NULL;
+}
+
+void recordWriterPush(void *context, const short *pcm, unsigned frames) {
+    RecordWriter *writer = (RecordWriter *) context;
+    RecordSlot slot;
+    while (frames > 0) {
+        slot.frames = frames < RECORD_SLOT_FRAMES ? frames : RECORD_SLOT_FRAMES;
+        memcpy(slot.pcm, pcm, slot.frames * sizeof(short));
+        if (!spscQueuePush(&writer->queue, &slot)) {
+            //写线程跟不上，这一块剩下的都丢掉，录音回调不能等
+            atomic_fetch_add_explicit(&writer->dropped, frames, memory_order_relaxed);
+            return;
+        }
+        pcm += slot.frames;
+        frames -= slot.frames;
+    }
+}
+
+uint64_t recordWriterDroppedFrames(RecordWriter *writer) {
+    return atomic_load_explicit(&writer->dropped, memory_order_relaxed);
+}
+
+bool recordWriterClose(RecordWriter *writer, uint64_t *frames) {
+    atomic_store_explicit(&writer->stopping, true, memory_order_release);
+    pthread_join(writer->thread, NULL);
+
+    bool ok = !writer->failed;
+    if (writer->format == RECORD_FORMAT_WAV) {
+        unsigned char header[WAV_HEADER_BYTES];
+        wavFormatHeader(header, writer->sampleRate, 1, 16, (uint32_t) writer->dataBytes);
+        ok = ok && pwrite(writer->fd, header, sizeof(header), 0) == sizeof(header);
+    }
+    ok = close(writer->fd) == 0 && ok;
+    if (frames != NULL) {
+        *frames = writer->dataBytes / sizeof(short);
+    }
+    spscQueueRelease(&writer->queue);
+    free(writer->batch);
+    free(writer);
+    return ok;
+}
@@ -0,0 +1,35 @@
+#ifndef NATIVEAUDIO_RECORD_WRITER_H
+#define NATIVEAUDIO_RECORD_WRITER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+//后台写文件的录音消费者：录音回调只把数据块拷进无锁队列，从不碰文件系统；
+//专用的写线程把数据块攒成 RECORD_WRITER_BATCH_BYTES 的整块写出，关闭时补全 WAV 文件头。
+//队列和攒批缓冲区的大小都是固定的，录多久内存都不会增长；写线程跟不上时丢弃数据并计数
+
+typedef enum {
+    RECORD_FORMAT_WAV = 0,
+    //裸的 16 位小端 PCM，没有文件头
+    RECORD_FORMAT_RAW,
+} RecordFormat;
+
+//每次 write 的大小，文件偏移也按它对齐（WAV 文件头算在第一块里）
+#define RECORD_WRITER_BATCH_BYTES (64 * 1024)
+
+typedef struct RecordWriter RecordWriter;
+
+//创建文件并启动写线程，失败返回 NULL
+RecordWriter *recordWriterOpen(const char *path, RecordFormat format, unsigned sampleRate);
+
+//CaptureCallback 形式的入口，只在录音回调线程中调用，不会阻塞
+void recordWriterPush(void *context, const short *pcm, unsigned frames);
+
+//因为队列满而丢弃的帧数，任意线程可读
+uint64_t recordWriterDroppedFrames(RecordWriter *writer);
+
+//停止写线程，写出剩余数据并补全文件头，释放 writer。调用前录音回调必须已经不再 push。
+//有任何写入失败时返回 false，*frames 不为 NULL 时返回实际写入的帧数
+bool recordWriterClose(RecordWriter *writer, uint64_t *frames);
+
+#endif //NATIVEAUDIO_RECORD_WRITER_H
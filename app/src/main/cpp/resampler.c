@@ -0,0 +1,194 @@
+#include "resampler.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dsp_kernels.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+//各质量档位：每相抽头数、Kaiser 窗 beta、截止频率相对奈奎斯特频率的比例
+static const struct {
+    unsigned taps;
+    double beta;
+    double rolloff;
+} qualityTiers[] = {
+        {8,  5.0, 0.80},
+        {16, 7.0, 0.88},
+        {32, 9.0, 0.92},
+};
+
+static unsigned gcd(unsigned a, unsigned b) {
+    while (b != 0) {
+        unsigned t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+//第一类零阶修正贝塞尔函数，级数展开
+static double besselI0(double x) {
+    double sum = 1.0, term = 1.0;
+    unsigned k;
+    for (k = 1; k < 50; ++k) {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+        if (term < sum * 1e-12) {
+            break;
+        }
+    }
+    return sum;
+}
+
+static double sinc(double x) {
+    if (fabs(x) < 1e-9) {
+        return 1.0;
+    }
+    return sin(M_PI * x) / (M_PI * x);
+}
+
+bool resamplerFilterInit(ResamplerFilter *filter, unsigned inRate, unsigned outRate,
+                         ResamplerQuality quality) {
+    memset(filter, 0, sizeof(*filter));
+    if (inRate == 0 || outRate == 0 || quality > RESAMPLER_QUALITY_HIGH) {
+        return false;
+    }
+    unsigned g = gcd(inRate, outRate);
+    unsigned phases = outRate / g;
+    unsigned step = inRate / g;
+    if (phases > RESAMPLER_MAX_PHASES) {
+        return false;
+    }
+
+    //降采样时截止频率按比例降低，窗口也要按比例加长
+    double scale = phases < step ? (double) phases / step : 1.0;
+    unsigned taps = (unsigned) ceil(qualityTiers[quality].taps / scale);
+    taps = (taps + 3) & ~3u;
+    if (taps > RESAMPLER_MAX_TAPS) {
+        taps = RESAMPLER_MAX_TAPS;
+    }
+    double fc = qualityTiers[quality].rolloff * scale;
+    double beta = qualityTiers[quality].beta;
+    double half = taps / 2.0;
+
+    float *coeffs = (float *) malloc((size_t) phases * taps * sizeof(float));
+    if (coeffs == NULL) {
+        return false;
+    }
+    double i0Beta = besselI0(beta);
+    unsigned p, k;
+    for (p = 0; p < phases; ++p) {
+        float *c = coeffs + (size_t) p * taps;
+        double sum = 0.0;
+        for (k = 0; k < taps; ++k) {
+            //窗口第 k 个样本到输出时刻的距离（以输入样本为单位）
+            double x = (half - 1.0 - k) + (double) p / phases;
+            double u = x / half;
+            double w = fabs(u) < 1.0 ? besselI0(beta * sqrt(1.0 - u * u)) / i0Beta : 0.0;
+            double h = fc * sinc(fc * x) * w;
+            c[k] = (float) h;
+            sum += h;
+        }
+        //每个相位归一化为单位直流增益，避免相位之间的增益起伏
+        for (k = 0; k < taps; ++k) {
+            c[k] = (float) (c[k] / sum);
+        }
+    }
+
+    filter->inRate = inRate;
+    filter->outRate = outRate;
+    filter->quality = quality;
+    filter->phases = phases;
+    filter->step = step;
+    filter->taps = taps;
+    filter->coeffs = coeffs;
+    return true;
+}
+
+void resamplerFilterRelease(ResamplerFilter *filter) {
+    free(filter->coeffs);
+    memset(filter, 0, sizeof(*filter));
+}
+
+unsigned resamplerOutputFrames(const ResamplerFilter *filter, unsigned inFrames) {
+    return (unsigned) (((uint64_t) inFrames * filter->phases + filter->step - 1) / filter->step);
+}
+
+void resamplerInit(Resampler *resampler, const ResamplerFilter *filter) {
+    resampler->filter = filter;
+    resamplerReset(resampler);
+}
+
+void resamplerReset(Resampler *resampler) {
+    memset(resampler->history, 0, 2 * resampler->filter->taps * sizeof(float));
+    resampler->writeIndex = 0;
+    resampler->phase = 0;
+    //第一个输出对齐第 0 个输入样本，窗口要读到它之后的 taps / 2 个样本
+    resampler->need = resampler->filter->taps / 2 + 1;
+}
+
+unsigned resamplerFlushFrames(const Resampler *resampler) {
+    return resampler->filter->taps / 2 + 1;
+}
+
+static short clampToShort(float v) {
+    if (v >= 32767.0f) {
+        return 32767;
+    }
+    if (v <= -32768.0f) {
+        return -32768;
+    }
+    return (short) lrintf(v);
+}
+
+unsigned resamplerProcess(Resampler *resampler, const short *in, unsigned *inFrames,
+                          short *out, unsigned outFrames) {
+    const ResamplerFilter *filter = resampler->filter;
+    unsigned taps = filter->taps;
+    unsigned consumed = 0, produced = 0;
+    while (produced < outFrames) {
+        while (resampler->need > 0) {
+            if (consumed == *inFrames) {
+                goto done;
+            }
+            float v = in != NULL ? (float) in[consumed] : 0.0f;
+            resampler->history[resampler->writeIndex] = v;
+            resampler->history[resampler->writeIndex + taps] = v;
+            if (++resampler->writeIndex == taps) {
+                resampler->writeIndex = 0;
+            }
+            ++consumed;
+            --resampler->need;
+        }
+        //writeIndex 处是最旧的样本，往后 taps 个就是按时间顺序排列的窗口
+        out[produced++] = clampToShort(
+                dsp->dotProduct(resampler->history + resampler->writeIndex,
+                                filter->coeffs + (size_t) resampler->phase * taps, taps));
+        resampler->phase += filter->step;
+        resampler->need = resampler->phase / filter->phases;
+        resampler->phase %= filter->phases;
+    }
+done:
+    *inFrames = consumed;
+    return produced;
+}
+
+unsigned resamplerConvert(const ResamplerFilter *filter, const short *in, unsigned inFrames,
+                          short *out) {
+    Resampler resampler;
+    resamplerInit(&resampler, filter);
+    unsigned total = resamplerOutputFrames(filter, inFrames);
+    unsigned frames = inFrames;
+    unsigned produced = resamplerProcess(&resampler, in, &frames, out, total);
+    //输入读完后用静音把滤波器尾部冲刷出来
+    while (produced < total) {
+        frames = filter->taps;
+        produced += resamplerProcess(&resampler, NULL, &frames, out + produced, total - produced);
+    }
+    return produced;
+}
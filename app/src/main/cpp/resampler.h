@@ -0,0 +1,70 @@
+#ifndef NATIVEAUDIO_RESAMPLER_H
+#define NATIVEAUDIO_RESAMPLER_H
+
+#include <stdbool.h>
+
+//多相加窗 sinc 重采样器，支持任意有理数比例 outRate/inRate。
+//比例约分为 L/M 后，每个输出样本只需要一次 taps 长度的点积
+typedef enum {
+    RESAMPLER_QUALITY_LOW = 0,
+    RESAMPLER_QUALITY_MEDIUM,
+    RESAMPLER_QUALITY_HIGH,
+} ResamplerQuality;
+
+//约分后的插值因子 L 超过这个值时不支持（常见采样率两两之间都在 1000 以内）
+#define RESAMPLER_MAX_PHASES 1024
+//每相抽头数的上限，降采样比例很大时按这个值截断。Resampler 的历史窗口按它内联分配，
+//所以在音频回调里开始一路新的流不需要分配内存
+#define RESAMPLER_MAX_TAPS 128
+
+//只读系数表，可以被多个 Resampler 共享
+typedef struct ResamplerFilter {
+    unsigned inRate;
+    unsigned outRate;
+    ResamplerQuality quality;
+    //插值因子 L：每个输入样本间隔内的相位数
+    unsigned phases;
+    //抽取因子 M：每个输出样本前进的相位数
+    unsigned step;
+    //每个相位的抽头数，4 的倍数
+    unsigned taps;
+    float *coeffs;
+} ResamplerFilter;
+
+//单路单声道流的状态，不持有任何堆内存
+typedef struct Resampler {
+    const ResamplerFilter *filter;
+    //最近 taps 个输入样本，每个样本写两次，窗口总是连续的 taps 个 float
+    float history[2 * RESAMPLER_MAX_TAPS];
+    unsigned writeIndex;
+    unsigned phase;
+    //产生下一个输出之前还需要读入的样本数
+    unsigned need;
+} Resampler;
+
+bool resamplerFilterInit(ResamplerFilter *filter, unsigned inRate, unsigned outRate,
+                         ResamplerQuality quality);
+
+void resamplerFilterRelease(ResamplerFilter *filter);
+
+//inFrames 个输入样本完整转换后的输出帧数
+unsigned resamplerOutputFrames(const ResamplerFilter *filter, unsigned inFrames);
+
+//绑定系数表并清空历史，可以在音频回调线程中调用
+void resamplerInit(Resampler *resampler, const ResamplerFilter *filter);
+
+void resamplerReset(Resampler *resampler);
+
+//当前这一路流的尾部还需要多少个静音输入才能全部冲刷出来
+unsigned resamplerFlushFrames(const Resampler *resampler);
+
+//从 in 读取最多 *inFrames 个样本，向 out 写入最多 outFrames 个样本，返回写入数，
+//*inFrames 更新为实际读取数。in 为 NULL 时按静音处理，用于冲刷滤波器尾部
+unsigned resamplerProcess(Resampler *resampler, const short *in, unsigned *inFrames,
+                          short *out, unsigned outFrames);
+
+//一次性转换整段数据，out 至少要有 resamplerOutputFrames 个样本，返回写入数
+unsigned resamplerConvert(const ResamplerFilter *filter, const short *in, unsigned inFrames,
+                          short *out);
+
+#endif //NATIVEAUDIO_RESAMPLER_H
@@ -0,0 +1,317 @@
+#include "reverb.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define REVERB_PRESET_SETTINGS(name, ...) {__VA_ARGS__},
+static const ReverbSettings presets[REVERB_PRESET_COUNT] = {
+        REVERB_PRESETS(REVERB_PRESET_SETTINGS)
+};
+#undef REVERB_PRESET_SETTINGS
+
+//density 为 1000 时 FDN 每路延迟线的长度（毫秒），两两之间没有简单的整数比，模态不会重叠
+static const float lineMillis[REVERB_LINES] = {
+        31.1f, 37.3f, 41.9f, 47.3f, 53.9f, 59.3f, 67.1f, 73.7f,
+};
+//输入扩散的全通延迟（毫秒）
+static const float diffuserMillis[REVERB_DIFFUSERS] = {4.77f, 3.59f, 12.73f, 9.31f};
+//早期反射各抽头相对 reflectionsDelay 的位置（毫秒），偶数号在左声道，奇数号在右声道
+static const float earlyMillis[REVERB_EARLY_TAPS] = {0.0f, 2.3f, 5.1f, 7.9f, 11.3f, 14.9f};
+
+//I3DL2 的 roomHFLevel 和 decayHFRatio 都以 5 kHz 为参考频率
+#define REVERB_HF_REFERENCE 5000.0f
+
+//输入停止后，各级递归状态按指数衰减，会在非规格化数范围里停留很久，每次运算慢几十倍。
+//输入上叠加一个远低于 int16 最低位的常数，所有状态都停在这个量级上，不会落进非规格化数；
+//不依赖各个平台设置 flush-to-zero 的方式
+#define REVERB_DENORMAL_GUARD 1e-18f
+
+static float millibelToGain(int millibel) {
+    return powf(10.0f, millibel / 2000.0f);
+}
+
+static unsigned millisToFrames(float millis, unsigned sampleRate) {
+    return (unsigned) (millis * sampleRate / 1000.0f + 0.5f);
+}
+
+static bool delayInit(ReverbDelay *delay, unsigned capacity) {
+    delay->buffer = (float *) calloc(capacity, sizeof(float));
+    delay->length = capacity;
+    delay->position = 0;
+    return delay->buffer != NULL;
+}
+
+bool reverbInit(Reverb *reverb, unsigned sampleRate) {
+    unsigned i, size = 1;
+    ReverbSettings settings;
+    memset(reverb, 0, sizeof(*reverb));
+    reverb->sampleRate = sampleRate;
+    unsigned maxPredelay = millisToFrames(REVERB_MAX_REFLECTIONS_DELAY_MS +
+                                          REVERB_MAX_REVERB_DELAY_MS +
+                                          earlyMillis[REVERB_EARLY_TAPS - 1], sampleRate) + 1;
+    while (size < maxPredelay) {
+        size <<= 1;
+    }
+    reverb->predelay = (float *) calloc(size, sizeof(float));
+    reverb->predelayMask = size - 1;
+    bool ok = reverb->predelay != NULL;
+    for (i = 0; i < REVERB_LINES && ok; ++i) {
+        reverb->lineCapacity[i] = millisToFrames(lineMillis[i], sampleRate) + 1;
+        ok = delayInit(&reverb->lines[i], reverb->lineCapacity[i]);
+    }
+    for (i = 0; i < REVERB_DIFFUSERS && ok; ++i) {
+        reverb->diffuserCapacity[i] = millisToFrames(diffuserMillis[i], sampleRate) + 1;
+        ok = delayInit(&reverb->diffusers[i], reverb->diffuserCapacity[i]);
+    }
+    if (!ok) {
+        reverbRelease(reverb);
+        return false;
+    }
+    reverbPresetSettings(REVERB_PRESET_STONECORRIDOR, &settings);
+    reverbSetSettings(reverb, &settings);
+    return true;
+}
+
+void reverbRelease(Reverb *reverb) {
+    unsigned i;
+    free(reverb->predelay);
+    reverb->predelay = NULL;
+    for (i = 0; i < REVERB_LINES; ++i) {
+        free(reverb->lines[i].buffer);
+        reverb->lines[i].buffer = NULL;
+    }
+    for (i = 0; i < REVERB_DIFFUSERS; ++i) {
+        free(reverb->diffusers[i].buffer);
+        reverb->diffusers[i].buffer = NULL;
+    }
+    reverb->sampleRate = 0;
+}
+
+bool reverbPresetSettings(int preset, ReverbSettings *out) {
+    if (preset < 0 || preset >= REVERB_PRESET_COUNT) {
+        return false;
+    }
+    *out = presets[preset];
+    return true;
+}
+
+//一阶低通 y = x + a * (y' - x) 在参考频率处的增益为 gain 时的系数 a，gain 不小于 1 时不滤波
+static float lowpassCoeff(float gain, unsigned sampleRate) {
+    float frequency = REVERB_HF_REFERENCE;
+    if (gain >= 0.9999f) {
+        return 0.0f;
+    }
+    if (gain < 0.001f) {
+        gain = 0.001f;
+    }
+    //8 kHz 输出时参考频率已经超过奈奎斯特频率，退到 0.4 倍采样率
+    if (frequency > 0.4f * sampleRate) {
+        frequency = 0.4f * sampleRate;
+    }
+    float c = cosf(2.0f * (float) M_PI * frequency / sampleRate);
+    float g2 = gain * gain;
+    return (1.0f - g2 * c - sqrtf(2.0f * g2 * (1.0f - c) - g2 * g2 * (1.0f - c * c))) /
+           (1.0f - g2);
+}
+
+static void setDelayLength(ReverbDelay *delay, unsigned length, unsigned capacity) {
+    if (length < 1) {
+        length = 1;
+    }
+    if (length > capacity) {
+        length = capacity;
+    }
+    if (length != delay->length) {
+        memset(delay->buffer, 0, capacity * sizeof(float));
+        delay->length = length;
+        delay->position = 0;
+    }
+}
+
+static int clampInt(int value, int low, int high) {
+    return value < low ? low : value > high ? high : value;
+}
+
+void reverbSetSettings(Reverb *reverb, const ReverbSettings *settings) {
+    unsigned rate = reverb->sampleRate, i;
+    int reflectionsDelay = clampInt(settings->reflectionsDelay, 0,
+                                    REVERB_MAX_REFLECTIONS_DELAY_MS);
+    int reverbDelay = clampInt(settings->reverbDelay, 0, REVERB_MAX_REVERB_DELAY_MS);
+    float decay = clampInt(settings->decayTime, 100, 20000) / 1000.0f;
+    float hfRatio = clampInt(settings->decayHFRatio, 100, 2000) / 1000.0f;
+    //模态密度越低延迟线越短，最短是 density 为 1000 时的 30%
+    float size = 0.3f + 0.7f * clampInt(settings->density, 0, 1000) / 1000.0f;
+    float room = millibelToGain(settings->roomLevel);
+
+    reverb->inputCoeff = lowpassCoeff(millibelToGain(clampInt(settings->roomHFLevel, -10000, 0)),
+                                      rate);
+    for (i = 0; i < REVERB_EARLY_TAPS; ++i) {
+        reverb->earlyDelay[i] = millisToFrames(reflectionsDelay + earlyMillis[i] * size, rate);
+    }
+    //每个声道三个抽头，总能量等于 reflectionsLevel
+    reverb->earlyGain = room * millibelToGain(settings->reflectionsLevel) / sqrtf(3.0f);
+    reverb->lateDelay = millisToFrames((float) (reflectionsDelay + reverbDelay), rate);
+    reverb->diffuserCoeff = 0.7f * clampInt(settings->diffusion, 0, 1000) / 1000.0f;
+    for (i = 0; i < REVERB_DIFFUSERS; ++i) {
+        setDelayLength(&reverb->diffusers[i], millisToFrames(diffuserMillis[i] * size, rate),
+                       reverb->diffuserCapacity[i]);
+    }
+
+    //每路的反馈增益让信号每绕一圈按 decayTime 衰减；高频衰减时间不能比低频长（那需要高架滤波器），
+    //超过 1 的比例按 1 处理
+    float energy = 0.0f;
+    for (i = 0; i < REVERB_LINES; ++i) {
+        ReverbDelay *line = &reverb->lines[i];
+        setDelayLength(line, millisToFrames(lineMillis[i] * size, rate), reverb->lineCapacity[i]);
+        float seconds = (float) line->length / rate;
+        float low = powf(10.0f, -3.0f * seconds / decay);
+        float high = powf(10.0f, -3.0f * seconds / (decay * (hfRatio < 1.0f ? hfRatio : 1.0f)));
+        reverb->lineGain[i] = low;
+        reverb->dampCoeff[i] = lowpassCoeff(high / low, rate);
+        energy += low * low;
+    }
+    //输入的能量经过反馈放大 1 / (1 - g^2) 倍，输出按它归一化，改变 decayTime 不改变响度
+    energy /= REVERB_LINES;
+    reverb->lateGain = room * millibelToGain(settings->reverbLevel) * sqrtf(1.0f - energy);
+    //尾音衰减 90 dB 所需的时间
+    reverb->tailFrames = reverb->lateDelay + millisToFrames(earlyMillis[REVERB_EARLY_TAPS - 1] +
+                                                            1500.0f * decay, rate);
+}
+
+void reverbReset(Reverb *reverb) {
+    unsigned i;
+    memset(reverb->predelay, 0, (reverb->predelayMask + 1) * sizeof(float));
+    for (i = 0; i < REVERB_LINES; ++i) {
+        memset(reverb->lines[i].buffer, 0, reverb->lineCapacity[i] * sizeof(float));
+        reverb->lines[i].position = 0;
+        reverb->dampState[i] = 0.0f;
+    }
+    for (i = 0; i < REVERB_DIFFUSERS; ++i) {
+        memset(reverb->diffusers[i].buffer, 0, reverb->diffuserCapacity[i] * sizeof(float));
+        reverb->diffusers[i].position = 0;
+    }
+    reverb->inputState = 0.0f;
+}
+
+//原地做 8 点 Hadamard 变换并归一化，反馈矩阵是正交的，网络本身不增减能量。
+//三级蝶形全部展开，循环形式的写法编译器不会展开，比整个 FDN 其余部分还慢
+static inline void hadamard8(float *v) {
+    float a0 = v[0] + v[1], a1 = v[0] - v[1], a2 = v[2] + v[3], a3 = v[2] - v[3];
+    float a4 = v[4] + v[5], a5 = v[4] - v[5], a6 = v[6] + v[7], a7 = v[6] - v[7];
+    float b0 = a0 + a2, b1 = a1 + a3, b2 = a0 - a2, b3 = a1 - a3;
+    float b4 = a4 + a6, b5 = a5 + a7, b6 = a4 - a6, b7 = a5 - a7;
+    const float scale = 0.35355339f;
+    v[0] = (b0 + b4) * scale;
+    v[1] = (b1 + b5) * scale;
+    v[2] = (b2 + b6) * scale;
+    v[3] = (b3 + b7) * scale;
+    v[4] = (b0 - b4) * scale;
+    v[5] = (b1 - b5) * scale;
+    v[6] = (b2 - b6) * scale;
+    v[7] = (b3 - b7) * scale;
+}
+
+//状态和系数先读进局部变量，总线是 float 指针，编译器不能假定它和 reverb 里的数据不重叠，
+//否则每个样本都要重新从内存读写全部状态
+void reverbProcess(Reverb *reverb, float *bus, unsigned frames, unsigned channels, bool feed) {
+    const unsigned mask = reverb->predelayMask;
+    float *predelay = reverb->predelay;
+    unsigned predelayPosition = reverb->predelayPosition;
+    const float inputCoeff = reverb->inputCoeff, diffuserCoeff = reverb->diffuserCoeff;
+    const float earlyGain = reverb->earlyGain, lateGain = reverb->lateGain;
+    const unsigned lateDelay = reverb->lateDelay;
+    float inputState = reverb->inputState;
+    unsigned earlyDelay[REVERB_EARLY_TAPS];
+    float *lineBuffer[REVERB_LINES], lineGain[REVERB_LINES], dampCoeff[REVERB_LINES];
+    float dampState[REVERB_LINES];
+    unsigned linePosition[REVERB_LINES], lineLength[REVERB_LINES];
+    float *diffuserBuffer[REVERB_DIFFUSERS];
+    unsigned diffuserPosition[REVERB_DIFFUSERS], diffuserLength[REVERB_DIFFUSERS];
+    unsigned n, i;
+    for (i = 0; i < REVERB_EARLY_TAPS; ++i) {
+        earlyDelay[i] = reverb->earlyDelay[i];
+    }
+    for (i = 0; i < REVERB_LINES; ++i) {
+        lineBuffer[i] = reverb->lines[i].buffer;
+        linePosition[i] = reverb->lines[i].position;
+        lineLength[i] = reverb->lines[i].length;
+        lineGain[i] = reverb->lineGain[i];
+        dampCoeff[i] = reverb->dampCoeff[i];
+        dampState[i] = reverb->dampState[i];
+    }
+    for (i = 0; i < REVERB_DIFFUSERS; ++i) {
+        diffuserBuffer[i] = reverb->diffusers[i].buffer;
+        diffuserPosition[i] = reverb->diffusers[i].position;
+        diffuserLength[i] = reverb->diffusers[i].length;
+    }
+
+    for (n = 0; n < frames; ++n) {
+        float *frame = bus + n * channels;
+        float x = REVERB_DENORMAL_GUARD;
+        if (feed) {
+            x += channels == 2 ? 0.5f * (frame[0] + frame[1]) : frame[0];
+        }
+        inputState = x + inputCoeff * (inputState - x);
+        predelay[predelayPosition] = inputState;
+        float earlyL = 0.0f, earlyR = 0.0f;
+        for (i = 0; i < REVERB_EARLY_TAPS; i += 2) {
+            earlyL += predelay[(predelayPosition - earlyDelay[i]) & mask];
+            earlyR += predelay[(predelayPosition - earlyDelay[i + 1]) & mask];
+        }
+        float late = predelay[(predelayPosition - lateDelay) & mask];
+        predelayPosition = (predelayPosition + 1) & mask;
+
+        //Schroeder 全通：把后期混响的输入打散成密集的回声
+        for (i = 0; i < REVERB_DIFFUSERS; ++i) {
+            float delayed = diffuserBuffer[i][diffuserPosition[i]];
+            float w = late + diffuserCoeff * delayed;
+            late = delayed - diffuserCoeff * w;
+            diffuserBuffer[i][diffuserPosition[i]] = w;
+            if (++diffuserPosition[i] == diffuserLength[i]) {
+                diffuserPosition[i] = 0;
+            }
+        }
+
+        float out[REVERB_LINES], feedback[REVERB_LINES];
+        for (i = 0; i < REVERB_LINES; ++i) {
+            out[i] = lineBuffer[i][linePosition[i]];
+            dampState[i] = out[i] + dampCoeff[i] * (dampState[i] - out[i]);
+            feedback[i] = lineGain[i] * dampState[i];
+        }
+        //左右声道取 Hadamard 矩阵的两行，两者正交
+        float lateL = out[0] - out[1] + out[2] - out[3] + out[4] - out[5] + out[6] - out[7];
+        float lateR = out[0] + out[1] - out[2] - out[3] + out[4] + out[5] - out[6] - out[7];
+        hadamard8(feedback);
+        late *= 0.35355339f;
+        for (i = 0; i < REVERB_LINES; ++i) {
+            lineBuffer[i][linePosition[i]] = feedback[i] + late;
+            if (++linePosition[i] == lineLength[i]) {
+                linePosition[i] = 0;
+            }
+        }
+
+        float left = earlyGain * earlyL + lateGain * lateL;
+        float right = earlyGain * earlyR + lateGain * lateR;
+        if (channels == 2) {
+            frame[0] += left;
+            frame[1] += right;
+        } else {
+            frame[0] += 0.70710678f * (left + right);
+        }
+    }
+
+    reverb->predelayPosition = predelayPosition;
+    reverb->inputState = inputState;
+    for (i = 0; i < REVERB_LINES; ++i) {
+        reverb->lines[i].position = linePosition[i];
+        reverb->dampState[i] = dampState[i];
+    }
+    for (i = 0; i < REVERB_DIFFUSERS; ++i) {
+        reverb->diffusers[i].position = diffuserPosition[i];
+    }
+}
@@ -0,0 +1,130 @@
+#ifndef NATIVEAUDIO_REVERB_H
+#define NATIVEAUDIO_REVERB_H
+
+#include <stdbool.h>
+
+//混音总线上的混响：输入是总线的单声道和，经过预延迟取出早期反射，
+//再经过几级全通扩散送进 8 路反馈延迟网络（FDN，Hadamard 反馈矩阵），每路反馈上有一阶低通，
+//低频和高频分别按 decayTime 和 decayTime * decayHFRatio 衰减 60 dB。左右声道取不同符号组合的输出，
+//彼此不相关。处理只用预先分配的内存，参数可以在音频回调里修改
+
+//参数的字段和单位与 OpenSL ES 的 SLEnvironmentalReverbSettings（I3DL2）相同
+typedef struct ReverbSettings {
+    //整个混响（早期反射和后期混响）的电平，毫贝
+    int roomLevel;
+    //5 kHz 处相对低频的电平，毫贝，不大于 0
+    int roomHFLevel;
+    //低频衰减 60 dB 的时间，毫秒
+    int decayTime;
+    //高频衰减时间与低频衰减时间之比，千分比
+    int decayHFRatio;
+    //早期反射相对 roomLevel 的电平，毫贝
+    int reflectionsLevel;
+    //第一个反射相对直达声的延迟，毫秒
+    int reflectionsDelay;
+    //后期混响相对 roomLevel 的电平，毫贝
+    int reverbLevel;
+    //后期混响相对第一个反射的延迟，毫秒
+    int reverbDelay;
+    //回声密度，千分比，决定输入扩散的程度
+    int diffusion;
+    //模态密度，千分比，决定延迟线的长度
+    int density;
+} ReverbSettings;
+
+//I3DL2 环境预设，数值与 OpenSLES.h 的 SL_I3DL2_ENVIRONMENT_PRESET_* 相同。
+//PRESET(名字, roomLevel, roomHFLevel, decayTime, decayHFRatio, reflectionsLevel,
+//       reflectionsDelay, reverbLevel, reverbDelay, diffusion, density)
+#define REVERB_PRESETS(PRESET) \
+        PRESET(GENERIC, -1000, -100, 1490, 830, -2602, 7, 200, 11, 1000, 1000) \
+        PRESET(PADDEDCELL, -1000, -6000, 170, 100, -1204, 1, 207, 2, 1000, 1000) \
+        PRESET(ROOM, -1000, -454, 400, 830, -1646, 2, 53, 3, 1000, 1000) \
+        PRESET(BATHROOM, -1000, -1200, 1490, 540, -370, 7, 1030, 11, 1000, 600) \
+        PRESET(LIVINGROOM, -1000, -6000, 500, 100, -1376, 3, -1104, 4, 1000, 1000) \
+        PRESET(STONEROOM, -1000, -300, 2310, 640, -711, 12, 83, 17, 1000, 1000) \
+        PRESET(AUDITORIUM, -1000, -476, 4320, 590, -789, 20, -289, 30, 1000, 1000) \
+        PRESET(CONCERTHALL, -1000, -500, 3920, 700, -1230, 20, -2, 29, 1000, 1000) \
+        PRESET(CAVE, -1000, 0, 2910, 1300, -602, 15, -302, 22, 1000, 1000) \
+        PRESET(ARENA, -1000, -698, 7240, 330, -1166, 20, 16, 30, 1000, 1000) \
+        PRESET(HANGAR, -1000, -1000, 10050, 230, -602, 20, 198, 30, 1000, 1000) \
+        PRESET(CARPETEDHALLWAY, -1000, -4000, 300, 100, -1831, 2, -1630, 30, 1000, 1000) \
+        PRESET(HALLWAY, -1000, -300, 1490, 590, -1219, 7, 441, 11, 1000, 1000) \
+        PRESET(STONECORRIDOR, -1000, -237, 2700, 790, -1214, 13, 395, 20, 1000, 1000) \
+        PRESET(ALLEY, -1000, -270, 1490, 860, -1204, 7, -4, 11, 1000, 1000) \
+        PRESET(FOREST, -1000, -3300, 1490, 540, -2560, 162, -613, 88, 790, 1000) \
+        PRESET(CITY, -1000, -800, 1490, 670, -2273, 7, -2217, 11, 500, 1000) \
+        PRESET(MOUNTAINS, -1000, -2500, 1490, 210, -2780, 300, -2014, 100, 270, 1000) \
+        PRESET(QUARRY, -1000, -1000, 1490, 830, -10000, 61, 500, 25, 1000, 1000) \
+        PRESET(PLAIN, -1000, -2000, 1490, 500, -2466, 179, -2514, 100, 210, 1000) \
+        PRESET(PARKINGLOT, -1000, 0, 1650, 1500, -1363, 8, -1153, 12, 1000, 1000) \
+        PRESET(SEWERPIPE, -1000, -1000, 2810, 140, 429, 14, 648, 21, 800, 600) \
+        PRESET(UNDERWATER, -1000, -4000, 1490, 100, -449, 7, 1700, 11, 1000, 1000)
+
+#define REVERB_PRESET_ENUM(name, ...) REVERB_PRESET_##name,
+typedef enum {
+    REVERB_PRESETS(REVERB_PRESET_ENUM)
+    REVERB_PRESET_COUNT,
+} ReverbPreset;
+#undef REVERB_PRESET_ENUM
+
+//I3DL2 允许的最大延迟，预延迟线按它们的和分配
+#define REVERB_MAX_REFLECTIONS_DELAY_MS 300
+#define REVERB_MAX_REVERB_DELAY_MS 100
+
+#define REVERB_LINES 8
+#define REVERB_DIFFUSERS 4
+#define REVERB_EARLY_TAPS 6
+
+typedef struct {
+    float *buffer;
+    //当前长度，不超过分配的长度
+    unsigned length;
+    unsigned position;
+} ReverbDelay;
+
+typedef struct Reverb {
+    unsigned sampleRate;
+    //分配时的长度，density 只能让延迟线变短
+    unsigned lineCapacity[REVERB_LINES];
+    unsigned diffuserCapacity[REVERB_DIFFUSERS];
+    //预延迟线长度是 2 的幂
+    float *predelay;
+    unsigned predelayMask;
+    unsigned predelayPosition;
+    ReverbDelay lines[REVERB_LINES];
+    ReverbDelay diffusers[REVERB_DIFFUSERS];
+
+    //由 ReverbSettings 换算出的系数
+    float inputCoeff;
+    float inputState;
+    unsigned earlyDelay[REVERB_EARLY_TAPS];
+    float earlyGain;
+    unsigned lateDelay;
+    float lateGain;
+    float diffuserCoeff;
+    float lineGain[REVERB_LINES];
+    float dampCoeff[REVERB_LINES];
+    float dampState[REVERB_LINES];
+    //输入停止后尾音衰减到 -90 dB 以下所需的帧数
+    unsigned tailFrames;
+} Reverb;
+
+//按 sampleRate 分配所有延迟线，参数初始为 STONECORRIDOR
+bool reverbInit(Reverb *reverb, unsigned sampleRate);
+
+void reverbRelease(Reverb *reverb);
+
+//返回预设的参数，preset 超出范围时返回 false
+bool reverbPresetSettings(int preset, ReverbSettings *out);
+
+//换算系数，不分配内存，可以在音频回调线程中调用。延迟线长度变化时清空对应的状态
+void reverbSetSettings(Reverb *reverb, const ReverbSettings *settings);
+
+//清空所有延迟线和滤波器状态
+void reverbReset(Reverb *reverb);
+
+//把混响叠加到 bus 上（frames 帧，单声道或交错立体声）。feed 为 false 时输入按静音处理，
+//只输出已有的尾音
+void reverbProcess(Reverb *reverb, float *bus, unsigned frames, unsigned channels, bool feed);
+
+#endif //NATIVEAUDIO_REVERB_H
@@ -0,0 +1,1000 @@
+"\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
+    "\x00\x80\x6c\x7d\xd8\x7a\x44\x78\xb0\x75\x1c\x73\x88\x70\xf4\x6d"
+    "\x60\x6b\xcc\x68\x38\x66\xa4\x63\x10\x61\x7c\x5e\xe8\x5b\x54\x59"
+    "\xc0\x56\x2c\x54\x98\x51\x04\x4f\x70\x4c\xdc\x49\x48\x47\xb4\x44"
+    "\x20\x42\x8c\x3f\xf8\x3c\x64\x3a\xd0\x37\x3c\x35\xa8\x32\x14\x30"
+    "\x80\x2d\xec\x2a\x58\x28\xc4\x25\x30\x23\x9c\x20\x08\x1e\x74\x1b"
+    "\xe0\x18\x4c\x16\xb8\x13\x24\x11\x90\x0e\xfc\x0b\x68\x09\xd4\x06"
+    "\x40\x04\xac\x01\x18\xff\x84\xfc\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2"
+    "\xa0\xef\x0c\xed\x78\xea\xe4\xe7\x50\xe5\xbc\xe2\x28\xe0\x94\xdd"
+    "\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8"
+    "\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4"
+    "\xc0\xb1\x2c\xaf\x98\xac\x04\xaa\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f"
+    "\x20\x9d\x8c\x9a\xf8\x97\x64\x95\xd0\x92\x3c\x90\xa8\x8d\x14\x8b"
+    "\x80\x88\xec\x85\x58\x83\xc4\x80\x00\x80\x6c\x7d\xd8\x7a\x44\x78"
+    "\xb0\x75\x1c\x73\x88\x70\xf4\x6d\x60\x6b\xcc\x68\x38\x66\xa4\x63"
+    "\x10\x61\x7c\x5e\xe8\x5b\x54\x59\xc0\x56\x2c\x54\x98\x51\x04\x4f"
+    "\x70\x4c\xdc\x49\x48\x47\xb4\x44\x20\x42\x8c\x3f\xf8\x3c\x64\x3a"
+    "\xd0\x37\x3c\x35\xa8\x32\x14\x30\x80\x2d\xec\x2a\x58\x28\xc4\x25"
+    "\x30\x23\x9c\x20\x08\x1e\x74\x1b\xe0\x18\x4c\x16\xb8\x13\x24\x11"
+    "\x90\x0e\xfc\x0b\x68\x09\xd4\x06\x40\x04\xac\x01\x18\xff\x84\xfc"
+    "\xf0\xf9\x5c\xf7\xc8\xf4\x34\xf2\xa0\xef\x0c\xed\x78\xea\xe4\xe7"
+    "\x50\xe5\xbc\xe2\x28\xe0\x94\xdd\x00\xdb\x6c\xd8\xd8\xd5\x44\xd3"
+    "\xb0\xd0\x1c\xce\x88\xcb\xf4\xc8\x60\xc6\xcc\xc3\x38\xc1\xa4\xbe"
+    "\x10\xbc\x7c\xb9\xe8\xb6\x54\xb4\xc0\xb1\x2c\xaf\x98\xac\x04\xaa"
+    "\x70\xa7\xdc\xa4\x48\xa2\xb4\x9f\x20\x9d\x8c\x9a\xf8\x97\x64\x95"
+    "\xd0\x92\x3c\x90\xa8\x8d\x14\x8b\x80\x88\xec\x85\x58\x83\xc4\x80"
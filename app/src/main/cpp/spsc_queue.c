@@ -0,0 +1,105 @@
+#include "spsc_queue.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+bool spscQueueInit(SpscQueue *queue, unsigned elementSize, unsigned capacity) {
+    if (capacity == 0 || (capacity & (capacity - 1)) != 0) {
+        return false;
+    }
+    queue->slots = (unsigned char *) calloc(capacity, elementSize);
+    if (queue->slots == NULL) {
+        return false;
+    }
+    queue->elementSize = elementSize;
+    queue->capacity = capacity;
+    atomic_init(&queue->head, 0);
+    atomic_init(&queue->tail, 0);
+    return true;
+}
+
+void spscQueueRelease(SpscQueue *queue) {
+    free(queue->slots);
+    queue->slots = NULL;
+    queue->capacity = 0;
+}
+
+bool spscQueuePush(SpscQueue *queue, const void *element) {
+    unsigned tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    if (tail - head == queue->capacity) {
+        return false;
+    }
+    memcpy(queue->slots + (tail & (queue->capacity - 1)) * queue->elementSize, element,
+           queue->elementSize);
+    //release 保证消费者看到新的 tail 时元素内容已经写完
+    atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+    return true;
+}
+
+bool spscQueuePop(SpscQueue *queue, void *element) {
+    unsigned head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    if (head == tail) {
+        return false;
+    }
+    memcpy(element, queue->slots + (head & (queue->capacity - 1)) * queue->elementSize,
+           queue->elementSize);
+    atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+    return true;
+}
+
+unsigned spscQueueSize(SpscQueue *queue) {
+    return atomic_load_explicit(&queue->tail, memory_order_acquire) -
+           atomic_load_explicit(&queue->head, memory_order_acquire);
+}
+
+//在环形区的 index 处拷贝 count 个元素，必要时分成两段
+static void copyOut(SpscQueue *queue, unsigned index, void *elements, unsigned count) {
+    unsigned mask = queue->capacity - 1;
+    unsigned first = queue->capacity - (index & mask);
+    if (first > count) {
+        first = count;
+    }
+    memcpy(elements, queue->slots + (index & mask) * queue->elementSize,
+           first * queue->elementSize);
+    memcpy((unsigned char *) elements + first * queue->elementSize, queue->slots,
+           (count - first) * queue->elementSize);
+}
+
+static void copyIn(SpscQueue *queue, unsigned index, const void *elements, unsigned count) {
+    unsigned mask = queue->capacity - 1;
+    unsigned first = queue->capacity - (index & mask);
+    if (first > count) {
+        first = count;
+    }
+    memcpy(queue->slots + (index & mask) * queue->elementSize, elements,
+           first * queue->elementSize);
+    memcpy(queue->slots, (const unsigned char *) elements + first * queue->elementSize,
+           (count - first) * queue->elementSize);
+}
+
+unsigned spscQueueWrite(SpscQueue *queue, const void *elements, unsigned count) {
+    unsigned tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    unsigned space = queue->capacity - (tail - head);
+    if (count > space) {
+        count = space;
+    }
+    copyIn(queue, tail, elements, count);
+    atomic_store_explicit(&queue->tail, tail + count, memory_order_release);
+    return count;
+}
+
+unsigned spscQueueRead(SpscQueue *queue, void *elements, unsigned count) {
+    unsigned head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    if (count > tail - head) {
+        count = tail - head;
+    }
+    if (elements != NULL) {
+        copyOut(queue, head, elements, count);
+    }
+    atomic_store_explicit(&queue->head, head + count, memory_order_release);
+    return count;
+}
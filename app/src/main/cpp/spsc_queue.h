@@ -0,0 +1,37 @@
+#ifndef NATIVEAUDIO_SPSC_QUEUE_H
+#define NATIVEAUDIO_SPSC_QUEUE_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+
+//单生产者单消费者的无等待环形队列，元素按值拷贝。
+//只有一个线程调用 spscQueuePush，只有一个线程调用 spscQueuePop，两边都不会阻塞，
+//适合在控制线程和音频回调线程之间传递命令或数据块
+typedef struct SpscQueue {
+    unsigned char *slots;
+    unsigned elementSize;
+    //容量必须是 2 的幂，读写位置只增不减，用掩码取下标
+    unsigned capacity;
+    atomic_uint head;
+    atomic_uint tail;
+} SpscQueue;
+
+bool spscQueueInit(SpscQueue *queue, unsigned elementSize, unsigned capacity);
+
+void spscQueueRelease(SpscQueue *queue);
+
+//队列已满时返回 false，不会覆盖尚未取出的元素
+bool spscQueuePush(SpscQueue *queue, const void *element);
+
+//队列为空时返回 false
+bool spscQueuePop(SpscQueue *queue, void *element);
+
+unsigned spscQueueSize(SpscQueue *queue);
+
+//批量版本，用于按样本传递的音频流：尽量多地写入/读出 count 个元素，返回实际个数。
+//elements 为 NULL 时 spscQueueRead 只丢弃元素
+unsigned spscQueueWrite(SpscQueue *queue, const void *elements, unsigned count);
+
+unsigned spscQueueRead(SpscQueue *queue, void *elements, unsigned count);
+
+#endif //NATIVEAUDIO_SPSC_QUEUE_H
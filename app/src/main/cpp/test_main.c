@@ -0,0 +1,616 @@
+//主机上的回归测试，每个用例检查引擎的一个部件，检查的内容见用例前的说明。
+//
+//    native-audio-test [名称]
+//
+//不带参数时运行全部用例，否则只运行名称相同的那个。每个失败的检查打印一行，有失败时退出码为 1。
+//ctest 为每个用例注册一个测试
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "audio_engine.h"
+#include "clip_cache.h"
+#include "decoded_cache.h"
+#include "dsp_kernels.h"
+#include "mixer.h"
+#include "resampler.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+static unsigned failures;
+
+#define CHECK(cond, ...) do { \
+    if (!(cond)) { \
+        ++failures; \
+        printf("%s:%d: ", __FILE__, __LINE__); \
+        printf(__VA_ARGS__); \
+        printf("\n"); \
+    } \
+} while (0)
+
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void sleepMillis(long millis) {
+    const struct timespec ts = {millis / 1000, millis % 1000 * 1000000};
+    nanosleep(&ts, NULL);
+}
+
+//可重复的伪随机数，范围 [-1, 1)
+static float nextNoise(unsigned *seed) {
+    *seed = *seed * 1664525u + 1013904223u;
+    return (float) (int) (*seed >> 8) / 8388608.0f - 1.0f;
+}
+
+static float maxDiff(const float *a, const float *b, unsigned n) {
+    float diff = 0.0f;
+    unsigned i;
+    for (i = 0; i < n; ++i) {
+        float d = fabsf(a[i] - b[i]);
+        if (d > diff) {
+            diff = d;
+        }
+    }
+    return diff;
+}
+
+//奇数长度，SIMD 版本的尾部循环也要走到
+#define DSP_TEST_FRAMES 1027
+
+//每个可用的 SIMD 内核都要和标量版本给出相同的结果；float 运算顺序不同，允许舍入误差
+static void testDsp(void) {
+    static short s16[DSP_TEST_FRAMES], refS16[DSP_TEST_FRAMES], simdS16[DSP_TEST_FRAMES];
+    static float a[2 * DSP_TEST_FRAMES], b[2 * DSP_TEST_FRAMES];
+    static float refOut[2 * DSP_TEST_FRAMES], simdOut[2 * DSP_TEST_FRAMES];
+    static float refL[DSP_TEST_FRAMES], refR[DSP_TEST_FRAMES];
+    static float simdL[DSP_TEST_FRAMES], simdR[DSP_TEST_FRAMES];
+    const float eps = 1e-5f;
+    const unsigned n = DSP_TEST_FRAMES;
+    const DspKernels *ref = dspKernels(DSP_ISA_SCALAR);
+    unsigned seed = 1, i;
+    int isa;
+    for (i = 0; i < 2 * n; ++i) {
+        //超出 [-1, 1) 的部分用来检查饱和
+        a[i] = nextNoise(&seed) * 1.25f;
+        b[i] = nextNoise(&seed) * 0.5f;
+    }
+    for (i = 0; i < n; ++i) {
+        s16[i] = (short) (nextNoise(&seed) * 32768.0f);
+    }
+    for (isa = DSP_ISA_SCALAR + 1; isa < DSP_ISA_COUNT; ++isa) {
+        const DspKernels *k = dspKernels((DspIsa) isa);
+        if (k == NULL) {
+            continue;
+        }
+        printf("dsp: checking %s\n", k->name);
+
+        ref->s16ToF32(s16, refOut, n);
+        k->s16ToF32(s16, simdOut, n);
+        CHECK(maxDiff(refOut, simdOut, n) == 0.0f, "%s s16ToF32 differs", k->name);
+
+        ref->f32ToS16(a, refS16, n);
+        k->f32ToS16(a, simdS16, n);
+        CHECK(memcmp(refS16, simdS16, sizeof(refS16)) == 0, "%s f32ToS16 differs", k->name);
+
+        //抖动序列和指令集有关，只检查它和不加抖动的结果最多差 1 LSB
+        DspDither dither;
+        dspDitherInit(&dither, 7);
+        k->f32ToS16Dither(b, simdS16, n, &dither);
+        ref->f32ToS16(b, refS16, n);
+        for (i = 0; i < n; ++i) {
+            if (abs(simdS16[i] - refS16[i]) > 1) {
+                break;
+            }
+        }
+        CHECK(i == n, "%s f32ToS16Dither is %d LSB off at %u", k->name,
+              i < n ? simdS16[i] - refS16[i] : 0, i);
+
+        memcpy(refOut, a, n * sizeof(float));
+        memcpy(simdOut, a, n * sizeof(float));
+        ref->gain(refOut, n, 0.7f);
+        k->gain(simdOut, n, 0.7f);
+        CHECK(maxDiff(refOut, simdOut, n) <= eps, "%s gain differs", k->name);
+
+        memcpy(refOut, a, n * sizeof(float));
+        memcpy(simdOut, a, n * sizeof(float));
+        ref->gainRamp(refOut, n, 0.2f, 0.9f);
+        k->gainRamp(simdOut, n, 0.2f, 0.9f);
+        CHECK(maxDiff(refOut, simdOut, n) <= eps, "%s gainRamp differs", k->name);
+
+        ref->pan(a, refOut, n, 0.3f, 0.8f);
+        k->pan(a, simdOut, n, 0.3f, 0.8f);
+        CHECK(maxDiff(refOut, simdOut, 2 * n) <= eps, "%s pan differs", k->name);
+
+        memcpy(refOut, b, n * sizeof(float));
+        memcpy(simdOut, b, n * sizeof(float));
+        ref->mix(refOut, a, n, 0.5f);
+        k->mix(simdOut, a, n, 0.5f);
+        CHECK(maxDiff(refOut, simdOut, n) <= eps, "%s mix differs", k->name);
+
+        memcpy(refOut, b, n * sizeof(float));
+        memcpy(simdOut, b, n * sizeof(float));
+        ref->mixRamp(refOut, a, n, 1.0f, 0.25f);
+        k->mixRamp(simdOut, a, n, 1.0f, 0.25f);
+        CHECK(maxDiff(refOut, simdOut, n) <= eps, "%s mixRamp differs", k->name);
+
+        memcpy(refOut, b, 2 * n * sizeof(float));
+        memcpy(simdOut, b, 2 * n * sizeof(float));
+        ref->mixPanRamp(refOut, a, n, 0.1f, 0.9f, 1.0f, 0.4f);
+        k->mixPanRamp(simdOut, a, n, 0.1f, 0.9f, 1.0f, 0.4f);
+        CHECK(maxDiff(refOut, simdOut, 2 * n) <= eps, "%s mixPanRamp differs", k->name);
+
+        ref->interleave(a, b, refOut, n);
+        k->interleave(a, b, simdOut, n);
+        CHECK(maxDiff(refOut, simdOut, 2 * n) == 0.0f, "%s interleave differs", k->name);
+
+        ref->deinterleave(a, refL, refR, n);
+        k->deinterleave(a, simdL, simdR, n);
+        CHECK(maxDiff(refL, simdL, n) == 0.0f && maxDiff(refR, simdR, n) == 0.0f,
+              "%s deinterleave differs", k->name);
+
+        float refDot = ref->dotProduct(a, b, n);
+        float simdDot = k->dotProduct(a, b, n);
+        CHECK(fabsf(refDot - simdDot) <= 1e-4f * (float) n, "%s dotProduct %f vs %f", k->name,
+              simdDot, refDot);
+    }
+}
+
+typedef struct {
+    unsigned inRate;
+    unsigned outRate;
+} RatePair;
+
+//一秒的直流和 1 kHz 正弦分别转换，去掉首尾各 10% 的滤波器过渡段，
+//直流增益误差不超过 1%，正弦的有效值误差不超过 2%、过零次数和频率一致
+static void testResampler(void) {
+    static const RatePair pairs[] = {
+            {8000,  48000},
+            {44100, 48000},
+            {48000, 16000},
+            {16000, 44100},
+            {22050, 8000},
+    };
+    const double amplitude = 16000.0, frequency = 1000.0;
+    unsigned p, q;
+    for (p = 0; p < sizeof(pairs) / sizeof(pairs[0]); ++p) {
+        unsigned inRate = pairs[p].inRate, outRate = pairs[p].outRate;
+        short *dc = (short *) malloc(inRate * sizeof(short));
+        short *sine = (short *) malloc(inRate * sizeof(short));
+        unsigned i;
+        for (i = 0; i < inRate; ++i) {
+            dc[i] = (short) (amplitude);
+            sine[i] = (short) lrint(amplitude * sin(2.0 * M_PI * frequency * i / inRate));
+        }
+        for (q = RESAMPLER_QUALITY_LOW; q <= RESAMPLER_QUALITY_HIGH; ++q) {
+            ResamplerFilter filter;
+            if (!resamplerFilterInit(&filter, inRate, outRate, (ResamplerQuality) q)) {
+                CHECK(false, "resamplerFilterInit %u -> %u quality %u failed", inRate, outRate,
+                      q);
+                continue;
+            }
+            unsigned outFrames = resamplerOutputFrames(&filter, inRate);
+            short *out = (short *) malloc(outFrames * sizeof(short));
+            unsigned produced = resamplerConvert(&filter, dc, inRate, out);
+            CHECK(produced == outFrames, "%u -> %u: %u frames, expected %u", inRate, outRate,
+                  produced, outFrames);
+            unsigned begin = produced / 10, end = produced - produced / 10;
+            double worst = 0.0;
+            for (i = begin; i < end; ++i) {
+                double error = fabs(out[i] - amplitude);
+                if (error > worst) {
+                    worst = error;
+                }
+            }
+            CHECK(worst <= amplitude * 0.01, "%u -> %u quality %u: DC error %.0f", inRate,
+                  outRate, q, worst);
+
+            produced = resamplerConvert(&filter, sine, inRate, out);
+            double energy = 0.0;
+            unsigned crossings = 0;
+            for (i = begin; i < end; ++i) {
+                energy += (double) out[i] * out[i];
+                if (i > begin && (out[i - 1] < 0) != (out[i] < 0)) {
+                    ++crossings;
+                }
+            }
+            double rms = sqrt(energy / (end - begin));
+            double expectedCrossings = 2.0 * frequency * (end - begin) / outRate;
+            CHECK(fabs(rms - amplitude / sqrt(2.0)) <= amplitude / sqrt(2.0) * 0.02,
+                  "%u -> %u quality %u: sine RMS %.0f", inRate, outRate, q, rms);
+            CHECK(fabs(crossings - expectedCrossings) <= 2.0,
+                  "%u -> %u quality %u: %u zero crossings, expected %.0f", inRate, outRate, q,
+                  crossings, expectedCrossings);
+            free(out);
+            resamplerFilterRelease(&filter);
+        }
+        free(dc);
+        free(sine);
+    }
+}
+
+#define SCHEDULE_BURST 256
+#define SCHEDULE_BURSTS 8
+
+//源和输出都是 8 kHz、不加抖动、没有过渡时间，输出逐样本等于源，
+//所以每个事件必须恰好在它的帧上生效，跨突发边界的事件也一样
+static void testScheduler(void) {
+    static short pcm[2000];
+    static short out[SCHEDULE_BURST * SCHEDULE_BURSTS];
+    unsigned i;
+    for (i = 0; i < sizeof(pcm) / sizeof(pcm[0]); ++i) {
+        pcm[i] = 1000;
+    }
+    AudioEngine *engine = audioEngineCreate();
+    CHECK(engine != NULL && audioEngineInit(engine, CLIP_SAMPLE_RATE, SCHEDULE_BURST),
+          "engine init failed");
+    if (engine == NULL) {
+        return;
+    }
+    audioEngineSetDither(engine, false);
+    audioEngineSetRampTime(engine, 0);
+    CHECK(audioEngineSchedulePcm(engine, 300, pcm, 2000, CLIP_SAMPLE_RATE, 1, NULL),
+          "schedule pcm failed");
+    CHECK(audioEngineScheduleStop(engine, 700), "schedule stop failed");
+    CHECK(audioEngineSchedulePcm(engine, 1000, pcm, 2000, CLIP_SAMPLE_RATE, 1, NULL),
+          "schedule pcm failed");
+    CHECK(audioEngineScheduleGroupVolume(engine, 1500, VOICE_GROUP_PCM, -10000),
+          "schedule volume failed");
+    for (i = 0; i < SCHEDULE_BURSTS; ++i) {
+        audioEngineRender(engine, out + i * SCHEDULE_BURST, SCHEDULE_BURST, 1, AUDIO_FORMAT_S16);
+    }
+    CHECK(audioEngineFrameTime(engine) == SCHEDULE_BURST * SCHEDULE_BURSTS,
+          "frame time %llu", (unsigned long long) audioEngineFrameTime(engine));
+    for (i = 0; i < SCHEDULE_BURST * SCHEDULE_BURSTS; ++i) {
+        short expected = (i >= 300 && i < 700) || (i >= 1000 && i < 1500) ? 1000 : 0;
+        if (out[i] != expected) {
+            CHECK(false, "frame %u is %d, expected %d", i, out[i], expected);
+            break;
+        }
+    }
+    audioEngineDestroy(engine);
+}
+
+#define LOOP_RATE 8000
+#define LOOP_FREQUENCY 440.0
+#define LOOP_BURST 256
+
+//渲染一个 440 Hz 正弦剪辑的循环区间，返回相邻两个输出样本的最大差值
+static float loopMaxStep(const short *clip, unsigned frames, unsigned crossfade) {
+    static float out[LOOP_BURST];
+    Mixer mixer;
+    float last = 0.0f, step = 0.0f;
+    unsigned burst, i;
+    if (!mixerInit(&mixer, LOOP_BURST)) {
+        return INFINITY;
+    }
+    int voice = mixerPlay(&mixer, clip, frames, MIXER_LOOP_FOREVER, NULL, 1.0f, 0, NULL);
+    mixerSetVoiceLoop(&mixer, voice, 1014, 3005, crossfade);
+    //区间要重复好几遍
+    for (burst = 0; burst < 80; ++burst) {
+        memset(out, 0, sizeof(out));
+        mixerRender(&mixer, out, LOOP_BURST, 1);
+        mixerAdvanceGroups(&mixer, LOOP_BURST);
+        for (i = 0; i < LOOP_BURST; ++i) {
+            if ((burst > 0 || i > 0) && fabsf(out[i] - last) > step) {
+                step = fabsf(out[i] - last);
+            }
+            last = out[i];
+        }
+    }
+    mixerRelease(&mixer);
+    return step;
+}
+
+//区间 [1014, 3005) 在波峰附近结束、从波谷附近开始，不是整周期，
+//直接跳回起点时接缝处有接近两倍振幅的跳变；
+//交叉淡化后相邻样本的差值应当和正弦本身的最大斜率同一个量级（等功率淡化最多放大到 √2 倍）
+static void testLoopCrossfade(void) {
+    static short clip[4000];
+    const double amplitude = 16000.0;
+    unsigned i;
+    for (i = 0; i < sizeof(clip) / sizeof(clip[0]); ++i) {
+        clip[i] = (short) lrint(amplitude * sin(2.0 * M_PI * LOOP_FREQUENCY * i / LOOP_RATE));
+    }
+    float natural = (float) (amplitude / 32768.0 * 2.0 * M_PI * LOOP_FREQUENCY / LOOP_RATE);
+    float hard = loopMaxStep(clip, 4000, 0);
+    float faded = loopMaxStep(clip, 4000, 200);
+    CHECK(hard > natural * 2.0f, "seam without crossfade should jump: %f vs %f", hard, natural);
+    CHECK(faded <= natural * 1.5f, "crossfaded seam steps %f, sine slope %f", faded, natural);
+}
+
+typedef struct {
+    AudioDecoder base;
+    unsigned position;
+    unsigned length;
+    //每次最多交出这么多帧，之后睡一毫秒，模拟很慢的解码器
+    unsigned slowFrames;
+} RampDecoder;
+
+//立体声输出时右声道是左声道取反
+static unsigned rampRead(AudioDecoder *decoder, short *dst, unsigned frames) {
+    RampDecoder *ramp = (RampDecoder *) decoder;
+    unsigned i;
+    if (ramp->position + frames > ramp->length) {
+        frames = ramp->length - ramp->position;
+    }
+    if (ramp->slowFrames != 0 && frames > ramp->slowFrames) {
+        frames = ramp->slowFrames;
+        sleepMillis(1);
+    }
+    for (i = 0; i < frames; ++i) {
+        if (decoder->stereo) {
+            dst[2 * i] = (short) (ramp->position + i);
+            dst[2 * i + 1] = (short) -(short) (ramp->position + i);
+        } else {
+            dst[i] = (short) (ramp->position + i);
+        }
+    }
+    ramp->position += frames;
+    return frames;
+}
+
+static void rampClose(AudioDecoder *decoder) {
+    free(decoder);
+}
+
+static const AudioDecoderOps rampOps = {"ramp", rampRead, rampClose};
+
+//frames 帧的锯齿（第 i 帧的值是 (short) i）
+static AudioDecoder *openRamp(unsigned frames, unsigned slowFrames) {
+    RampDecoder *ramp = (RampDecoder *) calloc(1, sizeof(RampDecoder));
+    ramp->base.ops = &rampOps;
+    ramp->base.sampleRate = 8000;
+    ramp->base.channels = 1;
+    ramp->base.frames = frames;
+    ramp->length = frames;
+    ramp->slowFrames = slowFrames;
+    return &ramp->base;
+}
+
+//立体声的锯齿，known 为 false 时不告诉缓存总帧数
+static AudioDecoder *openStereoRamp(unsigned frames, bool known) {
+    AudioDecoder *decoder = openRamp(frames, 0);
+    decoder->channels = 2;
+    decoder->frames = known ? frames : 0;
+    return decoder;
+}
+
+//剪辑缓存的引用计数：有声部在用的条目不会被淘汰，失效的条目在引用归零后才释放
+static void testClipCache(void) {
+    static short clip[8000];
+    ResamplerFilter filter;
+    ClipCache cache;
+    if (!resamplerFilterInit(&filter, 8000, 48000, RESAMPLER_QUALITY_MEDIUM)) {
+        CHECK(false, "resamplerFilterInit failed");
+        return;
+    }
+    //只放得下一个转换后的剪辑
+    clipCacheInit(&cache, 60000 * sizeof(short));
+    ClipCacheEntry *a = clipCacheInsert(&cache, 1, clip, 8000, &filter);
+    CHECK(a != NULL && cache.usedBytes == a->frames * sizeof(short), "insert a failed");
+    CHECK(clipCacheInsert(&cache, 2, clip, 8000, &filter) == NULL,
+          "a is still playing, b must not evict it");
+    clipCacheUnref(a);
+    ClipCacheEntry *b = clipCacheInsert(&cache, 2, clip, 8000, &filter);
+    CHECK(b != NULL, "idle a should have been evicted for b");
+    CHECK(clipCacheAcquire(&cache, 1, 48000) == NULL, "a should be gone");
+    CHECK(clipCacheAcquire(&cache, 2, 48000) == b && atomic_load(&b->refs) == 2,
+          "acquire should hit b and add a reference");
+    //有引用的条目失效后不再被查到，引用归零后才释放
+    clipCacheInvalidate(&cache, 2);
+    CHECK(clipCacheAcquire(&cache, 2, 48000) == NULL, "stale b is still found");
+    CHECK(cache.usedBytes > 0, "stale b freed while still referenced");
+    clipCacheUnref(b);
+    clipCacheUnref(b);
+    clipCacheInvalidate(&cache, -1);
+    CHECK(cache.usedBytes == 0, "%zu bytes left after invalidating everything", cache.usedBytes);
+    clipCacheRelease(&cache);
+    resamplerFilterRelease(&filter);
+}
+
+//解码缓存的引用计数与淘汰、渐进解码、立体声的平面布局，以及释放缓存时取消很慢的解码
+static void testDecodedCache(void) {
+    DecodedCache cache;
+    const unsigned frames = 20000;
+    //只放得下一个资源
+    decodedCacheInit(&cache, (frames + frames / 2) * sizeof(short));
+    DecodedAsset *a = decodedCacheInsert(&cache, "a", openRamp(frames, 0), false);
+    CHECK(a != NULL && a->frames == frames && a->pcm[12345] == 12345, "decode a failed");
+    CHECK(decodedCacheInsert(&cache, "b", openRamp(frames, 0), false) == NULL,
+          "a is still playing, b must not evict it");
+    decodedCacheUnref(a);
+    DecodedAsset *b = decodedCacheInsert(&cache, "b", openRamp(frames, 0), false);
+    CHECK(b != NULL, "idle a should have been evicted for b");
+    CHECK(decodedCacheFind(&cache, "a") == NULL, "a should be gone");
+    CHECK(decodedCacheAcquire(&cache, "b") == b && atomic_load(&b->refs) == 2,
+          "acquire should hit b and add a reference");
+    decodedCacheUnref(b);
+    decodedCacheUnref(b);
+
+    //渐进解码：插入时第一块已经可以播放，后台线程解码完后 ready 等于 frames
+    const unsigned longFrames = DECODED_CACHE_CHUNK_FRAMES * 5 + 100;
+    decodedCacheSetBudget(&cache, longFrames * sizeof(short));
+    DecodedAsset *c = decodedCacheInsert(&cache, "c", openRamp(longFrames, 0), true);
+    CHECK(c != NULL && atomic_load(&c->ready) >= DECODED_CACHE_CHUNK_FRAMES,
+          "progressive insert should publish the first chunk");
+    double deadline = nowSeconds() + 5.0;
+    while (c != NULL && atomic_load(&c->ready) < longFrames && nowSeconds() < deadline) {
+        sleepMillis(1);
+    }
+    CHECK(c != NULL && atomic_load(&c->ready) == longFrames && c->pcm[longFrames - 1] ==
+          (short) (longFrames - 1), "background decode did not finish");
+    if (c != NULL) {
+        decodedCacheUnref(c);
+    }
+
+    //立体声分成左右两个平面：渐进解码直接写进各自的平面；不知道总帧数时缓冲区加倍过几次，
+    //右声道的平面最后紧挨着左声道
+    decodedCacheSetBudget(&cache, 8 * longFrames * sizeof(short));
+    DecodedAsset *e = decodedCacheInsert(&cache, "e", openStereoRamp(longFrames, true), true);
+    deadline = nowSeconds() + 5.0;
+    while (e != NULL && atomic_load(&e->ready) < longFrames && nowSeconds() < deadline) {
+        sleepMillis(1);
+    }
+    CHECK(e != NULL && e->channels == 2 && atomic_load(&e->ready) == longFrames &&
+          e->pcm[longFrames - 1] == (short) (longFrames - 1) &&
+          e->pcm[2 * longFrames - 1] == (short) -(short) (longFrames - 1),
+          "progressive stereo decode should fill both planes");
+    DecodedAsset *f = decodedCacheInsert(&cache, "f", openStereoRamp(longFrames, false), false);
+    CHECK(f != NULL && f->channels == 2 && f->frames == longFrames &&
+          f->pcm[12345] == 12345 && f->pcm[longFrames + 12345] == -12345,
+          "unbounded stereo decode should end with packed planes");
+    if (e != NULL) {
+        decodedCacheUnref(e);
+    }
+    if (f != NULL) {
+        decodedCacheUnref(f);
+    }
+
+    //很慢的解码器，整个解码要好几秒：释放缓存时解码线程要在下一次读取前看到取消，不能等整块解码完
+    const unsigned slowFrames = DECODED_CACHE_CHUNK_FRAMES * 40;
+    decodedCacheSetBudget(&cache, slowFrames * sizeof(short));
+    DecodedAsset *d = decodedCacheInsert(&cache, "d", openRamp(slowFrames, 64), true);
+    CHECK(d != NULL && d->threadRunning && atomic_load(&d->ready) < slowFrames,
+          "slow decode should continue in the background");
+    double start = nowSeconds();
+    decodedCacheRelease(&cache);
+    CHECK(nowSeconds() - start < 0.5, "cancelling a slow decode took %.2f s",
+          nowSeconds() - start);
+}
+
+//渲染一个立体声突发，返回左右声道的峰值
+static void renderPeaks(AudioEngine *engine, float *left, float *right) {
+    static float out[2 * 256];
+    unsigned i;
+    audioEngineRender(engine, out, 256, 2, AUDIO_FORMAT_FLOAT);
+    *left = *right = 0.0f;
+    for (i = 0; i < 256; ++i) {
+        *left = fmaxf(*left, fabsf(out[2 * i]));
+        *right = fmaxf(*right, fabsf(out[2 * i + 1]));
+    }
+}
+
+//立体声资源的两个声道只送到各自那一侧，声道静音和独奏按 SLMuteSoloItf 的规则作用在对应的一侧
+static void testAssetChannels(void) {
+    static const struct {
+        unsigned channel;
+        bool solo;
+        bool on;
+        bool left;
+        bool right;
+    } steps[] = {
+            {0, false, true,  false, true},
+            //声道 0 既静音又独奏：独奏让声道 1 不可听，静音让声道 0 不可听
+            {0, true,  true,  false, false},
+            {0, false, false, true,  false},
+            {0, true,  false, true,  true},
+            {1, true,  true,  false, true},
+            {1, true,  false, true,  true},
+    };
+    unsigned k;
+    float left, right;
+    AudioEngine *engine = audioEngineCreate();
+    CHECK(engine != NULL && audioEngineInit(engine, 8000, 256), "engine init failed");
+    if (engine == NULL) {
+        return;
+    }
+    audioEngineSetRampTime(engine, 0);
+    CHECK(audioEngineLoadAsset(engine, "lr", openStereoRamp(8000, true), false) &&
+          audioEngineAssetChannels(engine, "lr") == 2, "stereo asset should keep two channels");
+    CHECK(audioEnginePlayAsset(engine, "lr", 1), "play failed");
+    renderPeaks(engine, &left, &right);
+    CHECK(left > 0.0f && right > 0.0f, "both sides should play (%f, %f)", left, right);
+    for (k = 0; k < sizeof(steps) / sizeof(steps[0]); ++k) {
+        if (steps[k].solo) {
+            audioEngineSetChannelSolo(engine, steps[k].channel, steps[k].on);
+        } else {
+            audioEngineSetChannelMute(engine, steps[k].channel, steps[k].on);
+        }
+        renderPeaks(engine, &left, &right);
+        CHECK((left > 0.0f) == steps[k].left && (right > 0.0f) == steps[k].right,
+              "step %u: left %f, right %f", k, left, right);
+    }
+    audioEngineDestroy(engine);
+}
+
+//八个一直播放的声部占满系数表后，第九种采样率只能失败；声部停下后它们的系数表可以被淘汰
+static void testFilterTable(void) {
+    static const unsigned rates[] = {8000, 11025, 12000, 16000, 22050, 24000, 32000, 44100};
+    static short pcm[100];
+    static short out[256];
+    unsigned r, k, i;
+    AudioEngine *engine = audioEngineCreate();
+    CHECK(engine != NULL && audioEngineInit(engine, 48000, 256), "engine init failed");
+    if (engine == NULL) {
+        return;
+    }
+    //播完的声部交还系数表，轮换二十种采样率不会把表占满
+    for (r = 8000; r < 28000; r += 1000) {
+        CHECK(audioEnginePlayPcm(engine, pcm, 100, r, 1, NULL), "play at %u Hz failed", r);
+        for (i = 0; i < 4; ++i) {
+            audioEngineRender(engine, out, 256, 1, AUDIO_FORMAT_S16);
+        }
+    }
+    for (k = 0; k < sizeof(rates) / sizeof(rates[0]); ++k) {
+        CHECK(audioEnginePlayPcm(engine, pcm, 100, rates[k], 1 << 30, NULL),
+              "long voice at %u Hz failed", rates[k]);
+    }
+    audioEngineRender(engine, out, 256, 1, AUDIO_FORMAT_S16);
+    CHECK(!audioEnginePlayPcm(engine, pcm, 100, 96000, 1, NULL),
+          "every filter is pinned, 96000 Hz should fail");
+    audioEngineSelectClip(engine, CLIP_NONE, 1);
+    audioEngineRender(engine, out, 256, 1, AUDIO_FORMAT_S16);
+    CHECK(audioEnginePlayPcm(engine, pcm, 100, 96000, 1, NULL),
+          "stopped voices should release their filters");
+    audioEngineDestroy(engine);
+}
+
+typedef struct {
+    const char *name;
+    void (*run)(void);
+} TestCase;
+
+//最后一项是结束标记
+static const TestCase tests[] = {
+        {"dsp",            testDsp},
+        {"resampler",      testResampler},
+        {"scheduler",      testScheduler},
+        {"loop",           testLoopCrossfade},
+        {"clip_cache",     testClipCache},
+        {"decoded_cache",  testDecodedCache},
+        {"asset_channels", testAssetChannels},
+        {"filters",        testFilterTable},
+        {NULL, NULL},
+};
+
+int main(int argc, char **argv) {
+    const char *only = argc > 1 ? argv[1] : NULL;
+    bool found = false;
+    unsigned i;
+    dspInit();
+    for (i = 0; tests[i].name != NULL; ++i) {
+        if (only != NULL && strcmp(only, tests[i].name) != 0) {
+            continue;
+        }
+        unsigned before = failures;
+        found = true;
+        tests[i].run();
+        printf("%s: %s\n", tests[i].name, failures == before ? "ok" : "FAILED");
+    }
+    if (only != NULL && !found) {
+        fprintf(stderr, "usage: native-audio-test [name]\n");
+        return 2;
+    }
+    return failures == 0 ? 0 : 1;
+}
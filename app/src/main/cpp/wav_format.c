@@ -0,0 +1,56 @@
+#include "wav_format.h"
+
+#include <string.h>
+
+static void putLe16(unsigned char *p, unsigned value) {
+    p[0] = (unsigned char) value;
+    p[1] = (unsigned char) (value >> 8);
+}
+
+static void putLe32(unsigned char *p, uint32_t value) {
+    p[0] = (unsigned char) value;
+    p[1] = (unsigned char) (value >> 8);
+    p[2] = (unsigned char) (value >> 16);
+    p[3] = (unsigned char) (value >> 24);
+}
+
+void wavFormatHeader(unsigned char *header, unsigned sampleRate, unsigned channels,
+                     unsigned bitsPerSample, uint32_t dataBytes) {
+    static const unsigned char riff[20] = {
+            'R', 'I', 'F', 'F', 0, 0, 0, 0, 'W', 'A', 'V', 'E',
+            'f', 'm', 't', ' ', 16, 0, 0, 0,
+    };
+    unsigned blockAlign = channels * (bitsPerSample / 8);
+    memcpy(header, riff, sizeof(riff));
+    putLe32(header + 4, 36 + dataBytes);
+    //1 = PCM，3 = IEEE float
+    putLe16(header + 20, bitsPerSample == 32 ? 3 : 1);
+    putLe16(header + 22, channels);
+    putLe32(header + 24, sampleRate);
+    putLe32(header + 28, sampleRate * blockAlign);
+    putLe16(header + 32, blockAlign);
+    putLe16(header + 34, bitsPerSample);
+    header[36] = 'd';
+    header[37] = 'a';
+    header[38] = 't';
+    header[39] = 'a';
+    putLe32(header + 40, dataBytes);
+}
+
+bool wavWriteHeader(FILE *file, unsigned sampleRate, unsigned channels, unsigned bitsPerSample,
+                    uint32_t dataBytes) {
+    unsigned char header[WAV_HEADER_BYTES];
+    wavFormatHeader(header, sampleRate, channels, bitsPerSample, dataBytes);
+    return fwrite(header, 1, sizeof(header), file) == sizeof(header);
+}
+
+bool wavFinalize(FILE *file, uint32_t dataBytes) {
+    unsigned char size[4];
+    bool ok = true;
+    putLe32(size, 36 + dataBytes);
+    ok = ok && fseek(file, 4, SEEK_SET) == 0 && fwrite(size, 1, 4, file) == 4;
+    putLe32(size, dataBytes);
+    ok = ok && fseek(file, 40, SEEK_SET) == 0 && fwrite(size, 1, 4, file) == 4;
+    ok = fseek(file, 0, SEEK_END) == 0 && ok;
+    return ok;
+}
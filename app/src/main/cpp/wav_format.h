@@ -0,0 +1,23 @@
+#ifndef NATIVEAUDIO_WAV_FORMAT_H
+#define NATIVEAUDIO_WAV_FORMAT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+//RIFF/WAVE 文件头：16/24 位是 PCM 整数格式，32 位按 IEEE float 格式写出（本项目不产生 32 位整数）。
+//多字节字段一律按小端序逐字节写出，与主机字节序无关
+#define WAV_HEADER_BYTES 44
+
+//在内存中生成文件头，用于自己管理写入的场合（例如后台写线程）
+void wavFormatHeader(unsigned char *header, unsigned sampleRate, unsigned channels,
+                     unsigned bitsPerSample, uint32_t dataBytes);
+
+//按 dataBytes 字节的 PCM 数据写出文件头，写到文件当前位置
+bool wavWriteHeader(FILE *file, unsigned sampleRate, unsigned channels, unsigned bitsPerSample,
+                    uint32_t dataBytes);
+
+//数据写完后回到文件开头改写 RIFF 和 data 块的长度，文件位置留在末尾
+bool wavFinalize(FILE *file, uint32_t dataBytes);
+
+#endif //NATIVEAUDIO_WAV_FORMAT_H
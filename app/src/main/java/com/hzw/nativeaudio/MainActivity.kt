@@ -16,6 +16,7 @@ import android.widget.Toast
 import androidx.appcompat.app.AppCompatActivity
 import androidx.core.app.ActivityCompat
 import com.hzw.nativeaudio.databinding.ActivityMainBinding
+import java.io.File
 
 class MainActivity : AppCompatActivity() {
 
@@ -25,11 +26,18 @@ class MainActivity : AppCompatActivity() {
         }
 
         private const val AUDIO_ECHO_REQUEST = 0
+        // 剪辑编号，与 clip_registry.h 里按剪辑表生成的枚举一一对应
         private const val CLIP_NONE = 0
         private const val CLIP_HELLO = 1
         private const val CLIP_ANDROID = 2
         private const val CLIP_SAWTOOTH = 3
         private const val CLIP_PLAYBACK = 4
+
+        // 录音的存储采样率，采集本身按设备本机采样率进行
+        private const val RECORDER_STORAGE_RATE = 16000
+        private const val CAPTURE_FORMAT_S16 = 0
+        private const val CAPTURE_FORMAT_S24 = 1
+        private const val CAPTURE_FORMAT_FLOAT = 2
     }
 
     var uri: String? = null
@@ -42,20 +50,44 @@ class MainActivity : AppCompatActivity() {
 
     private lateinit var binding: ActivityMainBinding
 
-    override fun onCreate(savedInstanceState: Bundle?) {
-        super.onCreate(savedInstanceState)
-        binding = ActivityMainBinding.inflate(layoutInflater)
-        setContentView(binding.root)
-        assetManager = assets
+    // native 引擎上下文的句柄，每个 JNI 调用都要带上它
+    private var engineHandle = 0L
+
+    @Volatile
+    private var engineStarted = false
+
+    // 第一次用到句柄时才等后台启动结束，onCreate 不会因为等引擎卡住界面线程
+    private val engine: Long
+        get() {
+            if (!engineStarted && engineHandle != 0L) {
+                awaitEngine(engineHandle)
+                engineStarted = true
+            }
+            return engineHandle
+        }
 
-        createEngine()
+    // 在后台预加载背景音乐的线程，销毁引擎前要等它结束
+    private var preloadThread: Thread? = null
 
+    override fun onCreate(savedInstanceState: Bundle?) {
+        super.onCreate(savedInstanceState)
         val audioManager = getSystemService(Context.AUDIO_SERVICE) as AudioManager
         val sampleRate = audioManager.getProperty(AudioManager.PROPERTY_OUTPUT_SAMPLE_RATE).toInt()
         val bufSize =
             audioManager.getProperty(AudioManager.PROPERTY_OUTPUT_FRAMES_PER_BUFFER).toInt()
 
-        createBufferQueueAudioPlayer(sampleRate, bufSize)
+        // 引擎和播放器在后台线程里创建，和下面的界面加载同时进行
+        engineHandle = createEngineAsync(sampleRate, bufSize)
+
+        binding = ActivityMainBinding.inflate(layoutInflater)
+        setContentView(binding.root)
+        assetManager = assets
+
+        // 先把背景音乐的播放器创建好放进池里，第一次点击时只需要签出。
+        // 等引擎、解码第一块和实例化播放器都在后台线程里进行，不占用界面线程
+        preloadThread = Thread {
+            preloadAssetAudioPlayer(engine, assetManager, "background.mp3")
+        }.apply { start() }
 
         val uriAdapter = ArrayAdapter.createFromResource(
             this, R.array.uri_spinner_array, android.R.layout.simple_spinner_item
@@ -81,21 +113,21 @@ class MainActivity : AppCompatActivity() {
             }
 
             hello.setOnClickListener {
-                selectClip(CLIP_HELLO, 5)
+                selectClip(engine, CLIP_HELLO, 5)
             }
 
             android.setOnClickListener {
-                selectClip(CLIP_ANDROID, 7)
+                selectClip(engine, CLIP_ANDROID, 7)
             }
 
             sawtooth.setOnClickListener {
-                selectClip(CLIP_SAWTOOTH, 1)
+                selectClip(engine, CLIP_SAWTOOTH, 1)
             }
 
             var isReverbEnable = false
             reverb.setOnClickListener {
                 isReverbEnable = !isReverbEnable
-                if (!enableReverb(isReverbEnable)) {
+                if (!enableReverb(engine, isReverbEnable)) {
                     isReverbEnable = !isReverbEnable
                 }
             }
@@ -104,11 +136,11 @@ class MainActivity : AppCompatActivity() {
                 var created = false
                 override fun onClick(v: View?) {
                     if (!created) {
-                        created = createAssetAudioPlayer(assetManager, "background.mp3")
+                        created = createAssetAudioPlayer(engine, assetManager, "background.mp3")
                     }
                     if (created) {
                         isPlayingAsset = !isPlayingAsset
-                        setPlayingAssetAudioPlayer(isPlayingAsset)
+                        setPlayingAssetAudioPlayer(engine, isPlayingAsset)
                     }
                 }
             })
@@ -117,29 +149,29 @@ class MainActivity : AppCompatActivity() {
                 var created = false
                 override fun onClick(v: View?) {
                     if (!created && !uri.isNullOrEmpty()) {
-                        created = createUriAudioPlayer(uri!!)
+                        created = createUriAudioPlayer(engine, uri!!)
                     }
                 }
             })
 
             pauseUri.setOnClickListener {
-                setPlayingUriAudioPlayer(false)
+                setPlayingUriAudioPlayer(engine, false)
             }
             playUri.setOnClickListener {
-                setPlayingUriAudioPlayer(true)
+                setPlayingUriAudioPlayer(engine, true)
             }
             loopUri.setOnClickListener(object : OnClickListener {
                 var isLooping = false
                 override fun onClick(v: View?) {
                     isLooping = !isLooping
-                    setLoopingUriAudioPlayer(isLooping)
+                    setLoopingUriAudioPlayer(engine, isLooping)
                 }
             })
             muteLeftUri.setOnClickListener(object : OnClickListener {
                 var muted = false
                 override fun onClick(v: View?) {
                     muted = !muted
-                    setChannelMuteUriAudioPlayer(0, muted)
+                    setChannelMuteUriAudioPlayer(engine, 0, muted)
                 }
             })
 
@@ -147,7 +179,7 @@ class MainActivity : AppCompatActivity() {
                 var muted = false
                 override fun onClick(v: View?) {
                     muted = !muted
-                    setChannelMuteUriAudioPlayer(1, muted)
+                    setChannelMuteUriAudioPlayer(engine, 1, muted)
                 }
             })
 
@@ -155,14 +187,14 @@ class MainActivity : AppCompatActivity() {
                 var soloed = false
                 override fun onClick(v: View?) {
                     soloed = !soloed
-                    setChannelSoloUriAudioPlayer(0, soloed)
+                    setChannelSoloUriAudioPlayer(engine, 0, soloed)
                 }
             })
             soloRightUri.setOnClickListener(object : OnClickListener {
                 var soloed = false
                 override fun onClick(v: View?) {
                     soloed = !soloed
-                    setChannelSoloUriAudioPlayer(1, soloed)
+                    setChannelSoloUriAudioPlayer(engine, 1, soloed)
                 }
             })
 
@@ -170,7 +202,7 @@ class MainActivity : AppCompatActivity() {
                 var muted = false
                 override fun onClick(v: View?) {
                     muted = !muted
-                    setMuteUriAudioPlayer(muted)
+                    setMuteUriAudioPlayer(engine, muted)
                 }
             })
 
@@ -178,13 +210,13 @@ class MainActivity : AppCompatActivity() {
                 var enabled = false
                 override fun onClick(v: View?) {
                     enabled = !enabled
-                    enableStereoPositionUriAudioPlayer(enabled)
+                    enableStereoPositionUriAudioPlayer(engine, enabled)
                 }
             })
 
             channelsUri.setOnClickListener {
                 if (numChannelsUri == 0) {
-                    numChannelsUri = getNumChannelsUriAudioPlayer()
+                    numChannelsUri = getNumChannelsUriAudioPlayer(engine)
                 }
                 Toast.makeText(
                     this@MainActivity, "Channels: $numChannelsUri", Toast.LENGTH_SHORT
@@ -209,7 +241,7 @@ class MainActivity : AppCompatActivity() {
 
                 override fun onStopTrackingTouch(seekBar: SeekBar?) {
                     val millibel = (100 - lastProgress) * -50
-                    setVolumeUriAudioPlayer(millibel)
+                    setVolumeUriAudioPlayer(engine, millibel)
                 }
             })
 
@@ -231,7 +263,7 @@ class MainActivity : AppCompatActivity() {
 
                 override fun onStopTrackingTouch(seekBar: SeekBar?) {
                     val millibel = (lastProgress - 50) * 20
-                    setStereoPositionUriAudioPlayer(millibel)
+                    setStereoPositionUriAudioPlayer(engine, millibel)
                 }
             })
 
@@ -247,21 +279,32 @@ class MainActivity : AppCompatActivity() {
                     )
                     return@setOnClickListener
                 }
-                recordAudio()
+                if (isRecording) {
+                    isRecording = !stopRecording(engine)
+                } else {
+                    recordAudio()
+                }
             }
             playback.setOnClickListener {
-                selectClip(CLIP_PLAYBACK, 3)
+                // 录音一直进行到再次点击 Record 或点击 Playback，之后播放最后 5 秒
+                if (isRecording) {
+                    isRecording = !stopRecording(engine)
+                }
+                selectClip(engine, CLIP_PLAYBACK, 3)
             }
         }
     }
 
     private var isCreatedRecord = false
+    private var isRecording = false
     private fun recordAudio() {
         if (!isCreatedRecord) {
-            isCreatedRecord = createAudioRecorder()
+            isCreatedRecord =
+                createAudioRecorder(engine, RECORDER_STORAGE_RATE, CAPTURE_FORMAT_FLOAT)
         }
         if (isCreatedRecord) {
-            startRecording()
+            setRecordingFile(engine, File(filesDir, "recording.wav").path, false)
+            isRecording = startRecording(engine)
         }
     }
 
@@ -269,17 +312,20 @@ class MainActivity : AppCompatActivity() {
 
         // turn off all audio
         selectClip(
-            CLIP_NONE, 0
+            engine, CLIP_NONE, 0
         )
         isPlayingAsset = false
-        setPlayingAssetAudioPlayer(false)
+        setPlayingAssetAudioPlayer(engine, false)
         isPlayingUri = false
-        setPlayingUriAudioPlayer(false)
+        setPlayingUriAudioPlayer(engine, false)
         super.onPause()
     }
 
     override fun onDestroy() {
-        shutdown()
+        preloadThread?.join()
+        preloadThread = null
+        shutdown(engine)
+        engineHandle = 0L
         super.onDestroy()
     }
 
@@ -303,41 +349,108 @@ class MainActivity : AppCompatActivity() {
         recordAudio()
     }
 
-    external fun createEngine()
+    // 创建一个 native 引擎上下文并返回它的句柄，其余函数的第一个参数都是这个句柄，shutdown 之后失效
+    external fun createEngine(): Long
+
+    external fun createBufferQueueAudioPlayer(handle: Long, sampleRate: Int, samplesPerBuf: Int)
+
+    // createEngine 加 createBufferQueueAudioPlayer 的异步版本，使用句柄前先调用 awaitEngine
+    external fun createEngineAsync(sampleRate: Int, samplesPerBuf: Int): Long
+
+    // 等后台启动结束，返回播放器是否在运行
+    external fun awaitEngine(handle: Long): Boolean
+
+    // 各启动阶段的耗时，单位纳秒，顺序见 native-audio-jni.c 的 StartupPhase；还没完成的阶段为 0
+    external fun getStartupTimings(handle: Long): LongArray
+
+    external fun createAssetAudioPlayer(
+        handle: Long,
+        assetManager: AssetManager,
+        fileName: String,
+    ): Boolean
+
+    // 预先创建资源播放器放进池里，之后 createAssetAudioPlayer 同一个资源不用再创建对象
+    external fun preloadAssetAudioPlayer(
+        handle: Long,
+        assetManager: AssetManager,
+        fileName: String,
+    ): Boolean
+
+    external fun setPlayingAssetAudioPlayer(handle: Long, isPlaying: Boolean)
+
+    external fun createUriAudioPlayer(handle: Long, uri: String): Boolean
+
+    external fun setPlayingUriAudioPlayer(handle: Long, isPlaying: Boolean)
+
+    external fun setLoopingUriAudioPlayer(handle: Long, isLooping: Boolean)
+
+    external fun setChannelMuteUriAudioPlayer(handle: Long, chan: Int, mute: Boolean)
+
+    external fun setChannelSoloUriAudioPlayer(handle: Long, chan: Int, solo: Boolean)
+
+    external fun getNumChannelsUriAudioPlayer(handle: Long): Int
+
+    external fun setVolumeUriAudioPlayer(handle: Long, millibel: Int)
+
+    external fun setMuteUriAudioPlayer(handle: Long, mute: Boolean)
+
+    external fun enableStereoPositionUriAudioPlayer(handle: Long, enable: Boolean)
+
+    external fun setStereoPositionUriAudioPlayer(handle: Long, permille: Int)
+
+    // 引擎内音量、静音和声像变化的过渡时间，0 为立即生效
+    external fun setRampTime(handle: Long, millis: Int)
+
+    external fun selectClip(handle: Long, which: Int, count: Int): Boolean
+
+    // 循环剪辑里的 [start, end) 帧（8 kHz 下），crossfade 帧等功率交叉淡化；count 为负时一直循环
+    external fun selectClipLoop(
+        handle: Long, which: Int, count: Int, start: Int, end: Int, crossfade: Int
+    ): Boolean
+
+    // 输出时钟（已经渲染的帧数），定时函数在这个时钟的第 frame 帧精确执行，可以在任意线程调用
+    external fun getFrameTime(handle: Long): Long
 
-    external fun createBufferQueueAudioPlayer(sampleRate: Int, samplesPerBuf: Int)
+    external fun scheduleClip(handle: Long, frame: Long, which: Int, count: Int): Boolean
 
-    external fun createAssetAudioPlayer(assetManager: AssetManager, fileName: String): Boolean
+    external fun scheduleStop(handle: Long, frame: Long): Boolean
 
-    external fun setPlayingAssetAudioPlayer(isPlaying: Boolean)
+    external fun scheduleGroupVolume(handle: Long, frame: Long, group: Int, millibel: Int): Boolean
 
-    external fun createUriAudioPlayer(uri: String): Boolean
+    external fun setResamplerQuality(handle: Long, quality: Int)
 
-    external fun setPlayingUriAudioPlayer(isPlaying: Boolean)
+    external fun setClipCacheBudget(handle: Long, budgetBytes: Int)
 
-    external fun setLoopingUriAudioPlayer(isLooping: Boolean)
+    // int16 输出时是否加 TPDF 抖动；播放器以 float 输出时没有影响
+    external fun setDither(handle: Long, enabled: Boolean)
 
-    external fun setChannelMuteUriAudioPlayer(chan: Int, mute: Boolean)
+    // 缓冲区队列播放器是否直接把 float 交给系统（PCM_EX），否则是 int16
+    external fun isFloatOutput(handle: Long): Boolean
 
-    external fun setChannelSoloUriAudioPlayer(chan: Int, solo: Boolean)
+    // 播放或录音回调的计时统计，字段顺序见 callback_stats.h，时间单位纳秒；返回 null 时稍后重试
+    external fun getCallbackStats(handle: Long, recorder: Boolean): LongArray?
 
-    external fun getNumChannelsUriAudioPlayer(): Int
+    external fun enableReverb(handle: Long, enable: Boolean): Boolean
 
-    external fun setVolumeUriAudioPlayer(millibel: Int)
+    // 混响预设，序号与 reverb.h 的 REVERB_PRESETS 相同（13 = STONECORRIDOR，默认）
+    external fun setReverbPreset(handle: Long, preset: Int): Boolean
 
-    external fun setMuteUriAudioPlayer(mute: Boolean)
+    // 按设备本机采样率以 format 格式采集，抽取到 storageRate 后交给引擎；设备不支持时退回 16 位
+    external fun createAudioRecorder(handle: Long, storageRate: Int, format: Int): Boolean
 
-    external fun enableStereoPositionUriAudioPlayer(enable: Boolean)
+    external fun startRecording(handle: Long): Boolean
 
-    external fun setStereoPositionUriAudioPlayer(permille: Int)
+    external fun stopRecording(handle: Long): Boolean
 
-    external fun selectClip(which: Int, count: Int): Boolean
+    external fun setRecordingFile(handle: Long, path: String?, raw: Boolean)
 
-    external fun enableReverb(enable: Boolean): Boolean
+    // 把麦克风直接混进播放输出，需要先创建播放器和录音器；还没在录音时会自动开始
+    external fun startMonitor(handle: Long, gain: Float): Boolean
 
-    external fun createAudioRecorder(): Boolean
+    external fun stopMonitor(handle: Long)
 
-    external fun startRecording(): Boolean
+    // 监听延迟和欠载统计，字段顺序见 audio_engine.h 的 MonitorStatsField，时间单位纳秒
+    external fun getMonitorStats(handle: Long): LongArray
 
-    external fun shutdown()
+    external fun shutdown(handle: Long)
 }
\ No newline at end of file